@@ -27,6 +27,7 @@ public interface IMonitorTypes {
 	
 	public static final String T_1LKPOOLINFO = "1LKPOOLINFO";
 	public static final String T_2LKPOOLTOTAL = "2LKPOOLTOTAL";
+	public static final String T_2LKPOOLLOOKUPS = "2LKPOOLLOOKUPS";
 	public static final String T_1LKMONPOOLDUMP = "1LKMONPOOLDUMP";
 	
 	public static final String T_2LKMONINUSE = "2LKMONINUSE";
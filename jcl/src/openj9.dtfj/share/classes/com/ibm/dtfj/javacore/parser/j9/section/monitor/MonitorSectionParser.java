@@ -70,6 +70,8 @@ public class MonitorSectionParser extends SectionParser implements IMonitorTypes
 		sovOnlyRules(T_1LKPOOLINFO);
 		// Not needed in DTFJ
 		processTagLineRequired(T_2LKPOOLTOTAL);
+		// Not needed in DTFJ, only written by newer VMs
+		processTagLineOptional(T_2LKPOOLLOOKUPS);
 		// Sov hook: Sov only information after the 2LKPOOLTOTAL tag
 		sovOnlyRules(T_2LKPOOLTOTAL);
 	}
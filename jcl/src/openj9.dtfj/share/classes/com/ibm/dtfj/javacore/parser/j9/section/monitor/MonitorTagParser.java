@@ -36,6 +36,7 @@ public class MonitorTagParser extends TagParser implements IMonitorTypes {
 	protected void initTagAttributeRules() {
 		addTag(T_1LKPOOLINFO, null);
 		addPoolTotal();
+		addTag(T_2LKPOOLLOOKUPS, null);
 		addTag(T_1LKMONPOOLDUMP, null);
 		addMonInUse();
 		addMonObject();
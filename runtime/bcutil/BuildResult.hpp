@@ -48,6 +48,7 @@ enum BuildResult {
 	InvalidAnnotation = BCT_ERR_INVALID_ANNOTATION,
 	LineNumberTableDecompressFailed = BCT_ERR_LINE_NUMBER_TABLE_DECOMPRESS_FAILED,
 	InvalidBytecodeSize = BCT_ERR_INVALID_BYTECODE_SIZE,
+	ClassAlreadyDefined = BCT_ERR_CLASS_ALREADY_DEFINED,
 };
 
 #endif /* BUILDRESULT_HPP_ */
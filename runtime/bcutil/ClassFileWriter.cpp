@@ -464,7 +464,7 @@ ClassFileWriter::analyzeMethods()
 			addEntry((void *) &STACK_MAP_TABLE, 0, CFR_CONSTANT_Utf8);
 		}
 
-		J9MethodDebugInfo* debugInfo = getMethodDebugInfoFromROMMethod(method);
+		J9MethodDebugInfo* debugInfo = getMethodDebugInfoForROMMethod(_javaVM, _romClass, method);
 		if (NULL != debugInfo) {
 			if (0 != debugInfo->lineNumberCount) {
 				addEntry((void *) &LINE_NUMBER_TABLE, 0, CFR_CONSTANT_Utf8);
@@ -493,6 +493,7 @@ ClassFileWriter::analyzeMethods()
 					addEntry((void *) &LOCAL_VARIABLE_TYPE_TABLE, 0, CFR_CONSTANT_Utf8);
 				}
 			}
+			releaseMethodDebugInfo(_javaVM, _romClass, debugInfo);
 		}
 		method = nextROMMethod(method);
 	}
@@ -1243,7 +1244,7 @@ ClassFileWriter::writeCodeAttribute(J9ROMMethod * method)
 		attributesCount += 1;
 	}
 
-	J9MethodDebugInfo* debugInfo = getMethodDebugInfoFromROMMethod(method);
+	J9MethodDebugInfo* debugInfo = getMethodDebugInfoForROMMethod(_javaVM, _romClass, method);
 	if (NULL != debugInfo) {
 		U_16 lineNumberCount(getLineNumberCount(debugInfo));
 
@@ -1263,6 +1264,7 @@ ClassFileWriter::writeCodeAttribute(J9ROMMethod * method)
 					writeU16(lineNumber.lineNumber);
 				} else {
 					_buildResult = LineNumberTableDecompressFailed;
+					releaseMethodDebugInfo(_javaVM, _romClass, debugInfo);
 					return;
 				}
 			}
@@ -1313,6 +1315,7 @@ ClassFileWriter::writeCodeAttribute(J9ROMMethod * method)
 				attributesCount += 1;
 			}
 		}
+		releaseMethodDebugInfo(_javaVM, _romClass, debugInfo);
 	}
 
 	writeU16At(attributesCount, attributesCountAddr);
@@ -66,7 +66,9 @@ ROMClassBuilder::ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, U
 	_bufferManagerBuffer(NULL),
 	_anonClassNameBuffer(NULL),
 	_anonClassNameBufferSize(0),
-	_stringInternTable(javaVM, portLibrary, maxStringInternTableSize)
+	_stringInternTable(javaVM, portLibrary, maxStringInternTableSize),
+	_internTable(&_stringInternTable),
+	_nextFreeBuilder(NULL)
 {
 }
 
@@ -102,6 +104,7 @@ ROMClassBuilder::getROMClassBuilder(J9PortLibrary *portLibrary, J9JavaVM *vm)
 			if (romClassBuilder->isOK()) {
 				ROMClassBuilder **romClassBuilderPtr = (ROMClassBuilder **)&(vm->dynamicLoadBuffers->romClassBuilder);
 				*romClassBuilderPtr = romClassBuilder;
+				releaseROMClassBuilder(vm, romClassBuilder);
 			} else {
 				romClassBuilder->~ROMClassBuilder();
 				j9mem_free_memory(romClassBuilder);
@@ -112,16 +115,79 @@ ROMClassBuilder::getROMClassBuilder(J9PortLibrary *portLibrary, J9JavaVM *vm)
 	return romClassBuilder;
 }
 
+ROMClassBuilder *
+ROMClassBuilder::acquireROMClassBuilder(J9PortLibrary *portLibrary, J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	J9TranslationBufferSet *dynamicLoadBuffers = vm->dynamicLoadBuffers;
+	ROMClassBuilder *vmROMClassBuilder = getROMClassBuilder(portLibrary, vm);
+	ROMClassBuilder *romClassBuilder = NULL;
+
+	if (NULL == vmROMClassBuilder) {
+		return NULL;
+	}
+
+	omrthread_monitor_enter(dynamicLoadBuffers->romClassBuilderPoolMutex);
+	romClassBuilder = (ROMClassBuilder *)dynamicLoadBuffers->romClassBuilderPool;
+	if (NULL != romClassBuilder) {
+		dynamicLoadBuffers->romClassBuilderPool = romClassBuilder->_nextFreeBuilder;
+		romClassBuilder->_nextFreeBuilder = NULL;
+	}
+	omrthread_monitor_exit(dynamicLoadBuffers->romClassBuilderPoolMutex);
+
+	if (NULL == romClassBuilder) {
+		/* Every builder in the pool is in use by another thread, add a new one which shares the VM's StringInternTable */
+		romClassBuilder = (ROMClassBuilder *)j9mem_allocate_memory(sizeof(ROMClassBuilder), J9MEM_CATEGORY_CLASSES);
+		if (NULL != romClassBuilder) {
+			new(romClassBuilder) ROMClassBuilder(vm, portLibrary, 0,
+					vmROMClassBuilder->_verifyExcludeAttribute,
+					vmROMClassBuilder->_verifyClassFunction);
+			romClassBuilder->_internTable = vmROMClassBuilder->_internTable;
+			Trc_BCU_acquireROMClassBuilder_Allocated(romClassBuilder);
+		}
+	}
+	return romClassBuilder;
+}
+
+void
+ROMClassBuilder::releaseROMClassBuilder(J9JavaVM *vm, ROMClassBuilder *romClassBuilder)
+{
+	J9TranslationBufferSet *dynamicLoadBuffers = vm->dynamicLoadBuffers;
+
+	omrthread_monitor_enter(dynamicLoadBuffers->romClassBuilderPoolMutex);
+	romClassBuilder->_nextFreeBuilder = (ROMClassBuilder *)dynamicLoadBuffers->romClassBuilderPool;
+	dynamicLoadBuffers->romClassBuilderPool = romClassBuilder;
+	omrthread_monitor_exit(dynamicLoadBuffers->romClassBuilderPoolMutex);
+}
+
 extern "C" void
 shutdownROMClassBuilder(J9JavaVM *vm)
 {
 	PORT_ACCESS_FROM_JAVAVM(vm);
-	ROMClassBuilder *romClassBuilder = (ROMClassBuilder *)vm->dynamicLoadBuffers->romClassBuilder;
+	J9TranslationBufferSet *dynamicLoadBuffers = vm->dynamicLoadBuffers;
+	ROMClassBuilder *romClassBuilder = (ROMClassBuilder *)dynamicLoadBuffers->romClassBuilderPool;
+
+	/* Free the pooled builders before the VM's builder, which owns the StringInternTable they share */
+	dynamicLoadBuffers->romClassBuilderPool = NULL;
+	while (NULL != romClassBuilder) {
+		ROMClassBuilder *nextFreeBuilder = romClassBuilder->_nextFreeBuilder;
+		if (romClassBuilder != dynamicLoadBuffers->romClassBuilder) {
+			romClassBuilder->~ROMClassBuilder();
+			j9mem_free_memory(romClassBuilder);
+		}
+		romClassBuilder = nextFreeBuilder;
+	}
+
+	romClassBuilder = (ROMClassBuilder *)dynamicLoadBuffers->romClassBuilder;
 	if ( NULL != romClassBuilder ) {
-		vm->dynamicLoadBuffers->romClassBuilder = NULL;
+		dynamicLoadBuffers->romClassBuilder = NULL;
 		romClassBuilder->~ROMClassBuilder();
 		j9mem_free_memory(romClassBuilder);
 	}
+	if (NULL != dynamicLoadBuffers->romClassBuilderPoolMutex) {
+		omrthread_monitor_destroy(dynamicLoadBuffers->romClassBuilderPoolMutex);
+		dynamicLoadBuffers->romClassBuilderPoolMutex = NULL;
+	}
 }
 
 #if defined(J9DYN_TEST)
@@ -177,7 +243,7 @@ j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDA
 	UDATA findClassFlags = loadData->options;
 
 	ROMClassSegmentAllocationStrategy romClassSegmentAllocationStrategy(javaVM, loadData->classLoader);
-	ROMClassBuilder *romClassBuilder = ROMClassBuilder::getROMClassBuilder(PORTLIB, javaVM);
+	ROMClassBuilder *romClassBuilder = ROMClassBuilder::acquireROMClassBuilder(PORTLIB, javaVM);
 	if (NULL == romClassBuilder) {
 		return BCT_ERR_OUT_OF_MEMORY;
 	}
@@ -188,6 +254,10 @@ j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDA
 			loadData->classLoader, (0 != classFileBytesReplaced), (TRUE == isIntermediateROMClass), localBuffer);
 
 	BuildResult result = romClassBuilder->buildROMClass(&context);
+	/* The caller holds the classTableMutex until it has consumed any classFileError left in the buffers of the
+	 * builder, and no other thread can acquire a builder before then, so the builder can be released now.
+	 */
+	ROMClassBuilder::releaseROMClassBuilder(javaVM, romClassBuilder);
 	loadData->romClass = context.romClass();
 	context.reportStatistics(localBuffer);
 
@@ -216,7 +286,26 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 
 	context->recordParseClassFileStart();
 	ClassFileParser classFileParser(_portLibrary, _verifyClassFunction);
+	/* Parsing and static verification only use the buffers of this builder, so other threads may define classes meanwhile */
+	context->releaseClassTableMutexForParse();
 	result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	if (context->reacquireClassTableMutexAfterParse() && (OK == result) && !context->isClassAnon()) {
+		/* Another thread may have defined the class while the mutex was released. Stop before anything is
+		 * allocated in the segments of the loader, so that the caller can report the duplicate definition.
+		 */
+		U_8 *name = context->className();
+		UDATA nameLength = context->classNameLength();
+		if ((NULL == name) || (0 == nameLength)) {
+			J9CfrClassFile *classFile = classFileParser.getParsedClassFile();
+			J9CfrConstantPoolInfo *nameInfo = &classFile->constantPool[classFile->constantPool[classFile->thisClass].slot1];
+			name = nameInfo->bytes;
+			nameLength = nameInfo->slot1;
+		}
+		if (context->isClassDefined(name, nameLength)) {
+			Trc_BCU_buildRomClass_DefinedWhileParsing(nameLength, name, context->classLoader());
+			result = ClassAlreadyDefined;
+		}
+	}
 	context->recordParseClassFileEnd();
 
 	if ( OK == result ) {
@@ -458,6 +547,17 @@ ROMClassBuilder::prepareAndLaydown( BufferManager *bufferManager, ClassFileParse
 	/* Pass the SRPOffsetTable to the ROMClassWriter to complete its initialization. */
 	romClassWriter.setSRPOffsetTable(&srpOffsetTable);
 
+	/* Must be done before the extra modifiers are computed and the ROM class is sized */
+	U_8 *compressedDebugInfo = NULL;
+	UDATA compressedDebugInfoSize = 0;
+	U_32 compressedDebugInfoMethodCount = 0;
+	if (context->canCompressDebugInfo()) {
+		BuildResult res = prepareCompressedDebugInfo(bufferManager, &classFileOracle, context, &compressedDebugInfo, &compressedDebugInfoSize, &compressedDebugInfoMethodCount);
+		if (OK != res) {
+			return res;
+		}
+	}
+
 	U_32 modifiers = classFileOracle.getAccessFlags();
 	U_32 extraModifiers = computeExtraModifiers(&classFileOracle, context);
 	U_32 optionalFlags = computeOptionalFlags(&classFileOracle, context);
@@ -757,6 +857,15 @@ ROMClassBuilder::prepareAndLaydown( BufferManager *bufferManager, ClassFileParse
 	 */
 	Trc_BCU_Assert_True_Level1(romSize <= maxRequiredSize);
 
+	/* The ROM class is not committed yet, so failing here releases its memory for reuse */
+	if (context->shouldCompressDebugInfo()) {
+		if (0 != _javaVM->internalVMFunctions->storeCompressedROMClassDebugInfo(_javaVM, context->classLoader(), (J9ROMClass *)romClassBuffer,
+				compressedDebugInfo, compressedDebugInfoSize, compressedDebugInfoMethodCount)
+		) {
+			return OutOfROM;
+		}
+	}
+
 	/*
 	 * inform the allocator what the final ROMSize is
 	 */
@@ -903,7 +1012,7 @@ ROMClassBuilder::finishPrepareAndLaydown(
 	U_8 * romClassBufferEndAddress = romClassBuffer + sizeInformation->rcWithOutUTF8sSize + sizeInformation->utf8sSize + sizeInformation->rawClassDataSize;
 	ROMClassStringInternManager internManager(
 			context,
-			&_stringInternTable,
+			_internTable,
 			srpOffsetTable,
 			srpKeyProducer,
 			romClassBuffer,
@@ -968,6 +1077,7 @@ ROMClassBuilder::finishPrepareAndLaydown(
 					internManager.visitUTF8(cpIndex, iterator.getUTF8Length(), iterator.getUTF8Data(), sharedCacheSRPRangeInfo);
 				}
 			}
+			internManager.recordLookupCounts();
 		}
 	}
 
@@ -1045,6 +1155,77 @@ ROMClassBuilder::finishPrepareAndLaydown(
 	return romSize;
 }
 
+/*
+ * Collect the method debug info which is kept compressed by the VM instead of inline in the ROM methods
+ * (-XX:+CompressROMClassDebugInfo). Each compressible method contributes its U_32 method index followed by
+ * its J9MethodDebugInfo laid out exactly as ROMClassWriter::writeMethodDebugInfo() writes it inline, so
+ * that the VM can hand out the inflated records as they are. Only methods without a local variable table
+ * are compressible, their debug info has no SRPs.
+ *
+ * The context is marked as compressing debug info only if at least one method is compressible.
+ */
+BuildResult
+ROMClassBuilder::prepareCompressedDebugInfo(BufferManager *bufferManager, ClassFileOracle *classFileOracle, ROMClassCreationContext *context, U_8 **data, UDATA *dataSize, U_32 *methodCount)
+{
+	UDATA size = 0;
+	U_32 count = 0;
+
+	for (ClassFileOracle::MethodIterator iterator = classFileOracle->getMethodIterator(); iterator.isNotDone(); iterator.next()) {
+		if (context->isMethodDebugInfoCompressible(iterator.getLineNumbersCount(), iterator.getLocalVariablesCount())) {
+			U_32 lineNumbersInfoCompressedSize = iterator.getLineNumbersInfoCompressedSize();
+			UDATA debugInfoSize = sizeof(J9MethodDebugInfo) + lineNumbersInfoCompressedSize;
+			if ((lineNumbersInfoCompressedSize >= 0xFFFF) || (iterator.getLineNumbersCount() >= 0x7FFF)) {
+				debugInfoSize += sizeof(U_32);
+			}
+			size += sizeof(U_32) + ROUND_UP_TO_POWEROF2(debugInfoSize, sizeof(U_32));
+			count += 1;
+		}
+	}
+
+	if (0 == count) {
+		return OK;
+	}
+
+	U_8 *buffer = (U_8 *) bufferManager->alloc(size);
+	if (NULL == buffer) {
+		return OutOfMemory;
+	}
+
+	U_8 *cursor = buffer;
+	for (ClassFileOracle::MethodIterator iterator = classFileOracle->getMethodIterator(); iterator.isNotDone(); iterator.next()) {
+		U_32 lineNumbersCount = iterator.getLineNumbersCount();
+		if (context->isMethodDebugInfoCompressible(lineNumbersCount, iterator.getLocalVariablesCount())) {
+			U_32 lineNumbersInfoCompressedSize = iterator.getLineNumbersInfoCompressedSize();
+			bool fits = (lineNumbersInfoCompressedSize < 0xFFFF) && (lineNumbersCount < 0x7FFF);
+			UDATA debugInfoSize = sizeof(J9MethodDebugInfo) + (fits ? 0 : sizeof(U_32)) + lineNumbersInfoCompressedSize;
+			U_32 *header = (U_32 *) cursor;
+
+			debugInfoSize = ROUND_UP_TO_POWEROF2(debugInfoSize, sizeof(U_32));
+			memset(cursor, 0, sizeof(U_32) + debugInfoSize);
+			*header++ = iterator.getIndex();
+			/* low tagged size, as for debug info stored inline */
+			*header++ = U_32(debugInfoSize) | 1;
+			if (fits) {
+				*header++ = (lineNumbersInfoCompressedSize << 16) | ((lineNumbersCount << 1) & 0xFFFE);
+				*header++ = 0;
+			} else {
+				*header++ = (lineNumbersCount << 1) | 1;
+				*header++ = 0;
+				*header++ = lineNumbersInfoCompressedSize;
+			}
+			memcpy(header, iterator.getLineNumbersInfoCompressed(), lineNumbersInfoCompressedSize);
+			cursor += sizeof(U_32) + debugInfoSize;
+		}
+	}
+	Trc_BCU_Assert_Equals(UDATA(cursor - buffer), size);
+
+	context->compressDebugInfo();
+	*data = buffer;
+	*dataSize = size;
+	*methodCount = count;
+	return OK;
+}
+
 /*
  * ROMClass->extraModifiers what does each bit represent?
  *
@@ -1060,7 +1241,7 @@ ROMClassBuilder::finishPrepareAndLaydown(
  *                               + UNUSED
  *
  *                             + UNUSED
- *                            + UNUSED
+ *                            + AccClassHasCompressedDebugInfo
  *                           + AccRecord
  *                          + AccClassAnonClass
  *
@@ -1203,6 +1384,10 @@ ROMClassBuilder::computeExtraModifiers(ClassFileOracle *classFileOracle, ROMClas
 		modifiers |= J9AccRecord;
 	}
 
+	if (context->shouldCompressDebugInfo()) {
+		modifiers |= J9AccClassHasCompressedDebugInfo;
+	}
+
 	return modifiers;
 }
 
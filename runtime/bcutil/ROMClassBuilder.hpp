@@ -51,6 +51,14 @@ class ROMClassBuilder
 public:
 	static ROMClassBuilder *getROMClassBuilder(J9PortLibrary *portLibrary, J9JavaVM *vm);
 
+	/**
+	 * Returns a ROMClassBuilder for the exclusive use of the caller until it is passed to releaseROMClassBuilder().
+	 * Builders not in use are kept in a pool, so that threads building ROMClasses at the same time each have their
+	 * own class file and buffer manager buffers. All builders intern into the StringInternTable of the VM's builder.
+	 */
+	static ROMClassBuilder *acquireROMClassBuilder(J9PortLibrary *portLibrary, J9JavaVM *vm);
+	static void releaseROMClassBuilder(J9JavaVM *vm, ROMClassBuilder *romClassBuilder);
+
 	ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, UDATA maxStringInternTableSize, U_8 * verifyExcludeAttribute, VerifyClassFunction verifyClassFunction);
 	~ROMClassBuilder();
 
@@ -121,11 +129,14 @@ private:
 	UDATA _anonClassNameBufferSize;
 	U_8 *_bufferManagerBuffer;
 	StringInternTable _stringInternTable;
+	StringInternTable *_internTable;
+	ROMClassBuilder *_nextFreeBuilder;
 
 	BuildResult handleAnonClassName(J9CfrClassFile *classfile, bool *isLambda);
 	U_32 computeExtraModifiers(ClassFileOracle *classFileOracle, ROMClassCreationContext *context);
 	U_32 computeOptionalFlags(ClassFileOracle *classFileOracle, ROMClassCreationContext *context);
 	BuildResult prepareAndLaydown( BufferManager *bufferManager, ClassFileParser *classFileParser, ROMClassCreationContext *context );
+	BuildResult prepareCompressedDebugInfo(BufferManager *bufferManager, ClassFileOracle *classFileOracle, ROMClassCreationContext *context, U_8 **data, UDATA *dataSize, U_32 *methodCount);
 	void checkDebugInfoCompression(J9ROMClass *romClass, ClassFileOracle classFileOracle, SRPKeyProducer *srpKeyProducer, ConstantPoolMap *constantPoolMap, SRPOffsetTable *srpOffsetTable);
 	U_32 finishPrepareAndLaydown(
 			U_8 *romClassBuffer,
@@ -68,11 +68,14 @@ public:
 		_verboseCurrentPhase(ROMClassCreation),
 		_buildResult(OK),
 		_forceDebugDataInLine(false),
+		_compressDebugInfo(false),
 		_doDebugCompare(false),
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_parsingOutsideClassTableMutex(false),
+		_deferredCFRError(NULL)
 	{
 	}
 
@@ -105,11 +108,14 @@ public:
 		_verboseCurrentPhase(ROMClassCreation),
 		_buildResult(OK),
 		_forceDebugDataInLine(false),
+		_compressDebugInfo(false),
 		_doDebugCompare(false),
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_parsingOutsideClassTableMutex(false),
+		_deferredCFRError(NULL)
 	{
 	}
 
@@ -149,11 +155,14 @@ public:
 		_verboseCurrentPhase(ROMClassCreation),
 		_buildResult(OK),
 		_forceDebugDataInLine(false),
+		_compressDebugInfo(false),
 		_doDebugCompare(false),
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(creatingIntermediateROMClass),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_parsingOutsideClassTableMutex(false),
+		_deferredCFRError(NULL)
 	{
 		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
 			/* localBuffer should not be NULL */
@@ -488,7 +497,10 @@ public:
 
 	void recordCFRError(U_8 *cfrError)
 	{
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
+		if (_parsingOutsideClassTableMutex) {
+			/* dynamicLoadBuffers is guarded by the classTableMutex, the error is recorded once it is reacquired */
+			_deferredCFRError = cfrError;
+		} else if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
 			_javaVM->dynamicLoadBuffers->classFileError = cfrError;
 		}
 	}
@@ -500,12 +512,69 @@ public:
 		 * into _javaVM->dynamicLoadBuffers->classFileError, if the internal buffer that is free'd matches the one in
 		 * _javaVM->dynamicLoadBuffers->classFileError, then it must be set to NULL to avoid a double free in
 		 * j9bcutil_freeTranslationBuffers()*/
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
+		if (_parsingOutsideClassTableMutex) {
+			if (buffer == _deferredCFRError) {
+				_deferredCFRError = NULL;
+			}
+		} else if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
 			_javaVM->dynamicLoadBuffers->classFileError = NULL;
 		}
 		j9mem_free_memory(buffer);
 	}
 
+	/**
+	 * Release the classTableMutex held by the caller while the class file is parsed, so that threads
+	 * defining classes can parse them in parallel. The mutex is kept when redefining or retransforming,
+	 * when -verbose:dynload statistics are being gathered in the VM wide J9DynamicLoadStats, and when a
+	 * class file error is waiting to be consumed. It is also kept for class path loads, whose bytes are
+	 * in the VM wide sunClassFileBuffer or a mapping that another class path load may overwrite or free.
+	 */
+	void releaseClassTableMutexForParse()
+	{
+#if defined(J9VM_THR_PREEMPTIVE)
+		if ((NULL != _javaVM)
+			&& (NULL != _javaVM->dynamicLoadBuffers)
+			&& (NULL == _clazz)
+			&& J9_ARE_NO_BITS_SET(_findClassFlags, J9_FINDCLASS_FLAG_REDEFINING | J9_FINDCLASS_FLAG_RETRANSFORMING | J9_FINDCLASS_FLAG_LOCALLY_DEFINED)
+			&& (_classFileBytes != _javaVM->dynamicLoadBuffers->sunClassFileBuffer)
+			&& (NULL == _dynamicLoadStats)
+			&& (NULL == _javaVM->dynamicLoadBuffers->classFileError)
+			&& (0 != omrthread_monitor_owned_by_self(_javaVM->classTableMutex))
+		) {
+			_parsingOutsideClassTableMutex = true;
+			omrthread_monitor_exit(_javaVM->classTableMutex);
+		}
+#endif /* J9VM_THR_PREEMPTIVE */
+	}
+
+	/**
+	 * Reacquire the classTableMutex released by releaseClassTableMutexForParse().
+	 *
+	 * @return true if the mutex had been released, in which case another thread may have defined the class meanwhile
+	 */
+	bool reacquireClassTableMutexAfterParse()
+	{
+		bool wasReleased = _parsingOutsideClassTableMutex;
+		if (_parsingOutsideClassTableMutex) {
+			omrthread_monitor_enter(_javaVM->classTableMutex);
+			_parsingOutsideClassTableMutex = false;
+			if (NULL != _deferredCFRError) {
+				_javaVM->dynamicLoadBuffers->classFileError = _deferredCFRError;
+				_deferredCFRError = NULL;
+			}
+		}
+		return wasReleased;
+	}
+
+	/**
+	 * Check whether a class of the given name is in the class table of the defining loader.
+	 * Must be called with the classTableMutex held.
+	 */
+	bool isClassDefined(U_8 *name, UDATA nameLength) const
+	{
+		return NULL != _javaVM->internalVMFunctions->hashClassTableAt(_classLoader, name, nameLength);
+	}
+
 	void recordLoadEnd(BuildResult result)
 	{
 		Trc_BCU_buildRomClass_Exit(result);
@@ -561,6 +630,41 @@ public:
 		_forceDebugDataInLine = true;
 	}
 
+	/*
+	 * Line number only method debug info may be left out of the ROM class and kept compressed by the VM
+	 * (-XX:+CompressROMClassDebugInfo). Classes which may be shared, redefined or retransformed, and
+	 * anonymous classes, which are unloaded on their own, always keep their debug info in the ROM class.
+	 */
+	bool canCompressDebugInfo() const
+	{
+		return (NULL != _javaVM)
+			&& J9_ARE_ANY_BITS_SET(_javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_COMPRESS_ROM_CLASS_DEBUG_INFO)
+			&& (NULL != _classLoader)
+			&& (_classLoader != _javaVM->anonClassLoader)
+			&& !isClassAnon()
+			&& !isRedefining()
+			&& !isRetransforming()
+			&& !isRetransformAllowed()
+			&& !isCreatingIntermediateROMClass()
+			&& shouldPreserveLineNumbers()
+			&& !isROMClassShareable()
+			&& !canPossiblyStoreDebugInfoOutOfLine();
+	}
+
+	void compressDebugInfo()
+	{
+		_compressDebugInfo = true;
+	}
+
+	bool shouldCompressDebugInfo() const { return _compressDebugInfo; }
+
+	bool isMethodDebugInfoCompressible(U_32 lineNumbersCount, U_32 localVariablesCount) const
+	{
+		/* Local variable tables hold SRPs to UTF8s in the ROM class, so they can not be moved out of it */
+		return (0 != lineNumbersCount)
+			&& ((0 == localVariablesCount) || !shouldPreserveLocalVariablesInfo());
+	}
+
 	bool shouldWriteDebugDataInline()
 	{
 		if (_doDebugCompare) {
@@ -742,11 +846,14 @@ private:
 	BuildResult _buildResult;
 	VerboseRecord _verboseRecords[ROMClassCreationPhaseCount];
 	bool _forceDebugDataInLine;
+	bool _compressDebugInfo;
 	bool _doDebugCompare;
 	J9ROMMethod * _existingRomMethod;
 	bool _reusingIntermediateClassData;
 	bool _creatingIntermediateROMClass;
 	J9ClassPatchMap *_patchMap;
+	bool _parsingOutsideClassTableMutex;
+	U_8 *_deferredCFRError;
 
 	J9ROMMethod * romMethodFromOffset(IDATA offset);
 };
@@ -48,7 +48,10 @@ ROMClassStringInternManager::ROMClassStringInternManager(
 		_baseAddress(IDATA(baseAddress)),
 		_endAddress(IDATA(endAddress)),
 		_hasStringTableLock(hasStringTableLock),
-		_isSharedROMClass(isSharedROMClass)
+		_isSharedROMClass(isSharedROMClass),
+		_lookupCount(0),
+		_localHitCount(0),
+		_sharedHitCount(0)
 {
 }
 
@@ -92,13 +95,34 @@ ROMClassStringInternManager::visitUTF8(U_16 cpIndex, U_16 utf8Length, U_8 *utf8D
 	searchInfo.sharedCacheSRPRangeInfo = sharedCacheSRPRangeInfo;
 
 	J9InternSearchResult result;
+	_lookupCount += 1;
 	if (_stringInternTable->findUtf8(&searchInfo, sharedTable, _isSharedROMClass, &result)) {
 		IDATA internedString = IDATA(result.utf8);
 		_stringInternTable->markNodeAsUsed(&result, sharedTable);
+		if (result.isSharedNode) {
+			_sharedHitCount += 1;
+		} else {
+			_localHitCount += 1;
+		}
 		_srpOffsetTable->setInternedAt(_srpKeyProducer->mapCfrConstantPoolIndexToKey(cpIndex), (U_8 *)internedString);
 	}
 }
 
+/**
+ * This function adds the lookups made by visitUTF8() for this ROMClass to the
+ * string intern table statistics, so that the shared counters are updated once
+ * per class rather than once per UTF8.
+ * @return void
+ *
+ */
+void
+ROMClassStringInternManager::recordLookupCounts()
+{
+	if (0 != _lookupCount) {
+		_stringInternTable->addLookupCounts(_lookupCount, _localHitCount, _sharedHitCount);
+	}
+}
+
 /**
  * This function is used to add the given UTF8 into one of the string intern tables.
  * It is added into shared string intern table if it is in the shared cache and 
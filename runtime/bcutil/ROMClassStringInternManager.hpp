@@ -57,6 +57,7 @@ public:
 
 	void visitUTF8(U_16 cpIndex, U_16 utf8Length, U_8 *utf8Data, SharedCacheRangeInfo sharedCacheSRPRangeInfo);
 	void internString(J9UTF8 *string);
+	void recordLookupCounts();
 	bool isInterningEnabled() const { return _context->isInterningEnabled(); }
 	bool isSharedROMClass() const { return _isSharedROMClass; }
 
@@ -69,6 +70,9 @@ private:
 	IDATA _endAddress;
 	bool _hasStringTableLock;
 	bool _isSharedROMClass;
+	UDATA _lookupCount;
+	UDATA _localHitCount;
+	UDATA _sharedHitCount;
 };
 
 #endif /* ROMCLASSSTRINGINTERNMANAGER_HPP_ */
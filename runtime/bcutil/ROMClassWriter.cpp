@@ -1148,6 +1148,14 @@ ROMClassWriter::writeMethods(Cursor *cursor, Cursor *lineNumberCursor, Cursor *v
 				((iterator.getLineNumbersCount() > 0) || (iterator.getLocalVariablesCount() > 0)) &&
 				(_context->shouldPreserveLineNumbers() || _context->shouldPreserveLocalVariablesInfo());
 
+		if (writeDebugInfo
+			&& _context->shouldCompressDebugInfo()
+			&& _context->isMethodDebugInfoCompressible(iterator.getLineNumbersCount(), iterator.getLocalVariablesCount())
+		) {
+			/* Kept compressed outside of the ROM class, see ROMClassBuilder::prepareCompressedDebugInfo() */
+			writeDebugInfo = false;
+		}
+
 		/* If an existing method is being compared to, then calling 
 		 * romMethodCacheCurrentRomMethod will cache the existing 
 		 * rom method in the context. This prevents the need to constantly 
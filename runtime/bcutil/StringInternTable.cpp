@@ -33,6 +33,7 @@
 #include "ut_j9bcu.h"
 #include "bcutil_internal.h"
 #include "SCStringInternHelpers.h"
+#include "AtomicSupport.hpp"
 
 /*
  * If you set VERIFY_ON_EVERY_OPERATION to 1, then the intern table
@@ -116,12 +117,7 @@ internHashFn(void *key, void *userData)
 		data = ((J9InternHashTableQuery*)node)->data;
 	}
 
-	UDATA hash = UDATA(node->classLoader);
-	for (UDATA i = 0; i < length; i++) {
-		hash = (hash << 5) - hash + data[i];
-	}
-
-	return hash;
+	return computeHashForBytes(UDATA(node->classLoader), data, length);
 }
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -144,7 +140,10 @@ StringInternTable::StringInternTable(J9JavaVM *vm, J9PortLibrary *portLibrary, U
 	_headNode(NULL),
 	_tailNode(NULL),
 	_nodeCount(0),
-	_maximumNodeCount(maximumNodeCount)
+	_maximumNodeCount(maximumNodeCount),
+	_lookupCount(0),
+	_localHitCount(0),
+	_sharedHitCount(0)
 {
 	if (0 != maximumNodeCount) {
 		_internHashTable = hashTableNew(OMRPORT_FROM_J9PORT(_portLibrary), J9_GET_CALLSITE(),
@@ -188,6 +187,14 @@ StringInternTable::~StringInternTable()
 	}
 }
 
+void
+StringInternTable::addLookupCounts(UDATA lookupCount, UDATA localHitCount, UDATA sharedHitCount)
+{
+	VM_AtomicSupport::add(&_lookupCount, lookupCount);
+	VM_AtomicSupport::add(&_localHitCount, localHitCount);
+	VM_AtomicSupport::add(&_sharedHitCount, sharedHitCount);
+}
+
 bool
 StringInternTable::findUtf8(J9InternSearchInfo *searchInfo, J9SharedInvariantInternTable *sharedInternTable, bool isSharedROMClass, J9InternSearchResult *result)
 {
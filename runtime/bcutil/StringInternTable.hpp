@@ -88,6 +88,13 @@ public:
 
 	J9InternHashTableEntry * getLRUHead() const { return _headNode; }
 
+	/* Add the lookups made while building one ROMClass, which are counted by the builder. */
+	void addLookupCounts(UDATA lookupCount, UDATA localHitCount, UDATA sharedHitCount);
+
+	UDATA lookupCount() const { return _lookupCount; }
+	UDATA localHitCount() const { return _localHitCount; }
+	UDATA sharedHitCount() const { return _sharedHitCount; }
+
 	bool verify(const char *file, IDATA line) const;
 
 #if defined(J9VM_ENV_DATA64)
@@ -121,6 +128,9 @@ private:
 	J9InternHashTableEntry *_tailNode;
 	UDATA _nodeCount;
 	UDATA _maximumNodeCount;
+	UDATA _lookupCount;
+	UDATA _localHitCount;
+	UDATA _sharedHitCount;
 
 	J9InternHashTableEntry * insertLocalNode(J9InternHashTableEntry *node, bool promoteIfExistingFound);
 	void deleteLocalNode(J9InternHashTableEntry *node);
@@ -163,9 +163,11 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 			vm->mapMemoryResultsBuffer = j9mem_allocate_memory(vm->mapMemoryBufferSize, J9MEM_CATEGORY_CLASSES);
 
 			if (omrthread_monitor_init_with_name(&vm->mapMemoryBufferMutex, 0, "global mapMemoryBuffer mutex")
+			|| omrthread_monitor_init_with_name(&vm->mapCacheMutex, 0, "stack map cache mutex")
+			|| omrthread_monitor_init_with_name(&translationBuffers->romClassBuilderPoolMutex, 0, "ROMClassBuilder pool mutex")
 			|| (vm->mapMemoryResultsBuffer == NULL)
 			) {
-				loadInfo->fatalErrorStr = "initial global mapMemoryBuffer or mapMemoryBufferMutex allocation failed";
+				loadInfo->fatalErrorStr = "initial global mapMemoryBuffer, mapMemoryBufferMutex, mapCacheMutex or romClassBuilderPoolMutex allocation failed";
 				returnVal = J9VMDLLMAIN_FAILED;
 			}
 			vm->mapMemoryBuffer = vm->mapMemoryResultsBuffer + MAP_MEMORY_RESULTS_BUFFER_SIZE;
@@ -189,6 +191,10 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 			if (vm->mapMemoryBufferMutex) {
 				omrthread_monitor_destroy(vm->mapMemoryBufferMutex);
 			}
+			if (vm->mapCacheMutex) {
+				omrthread_monitor_destroy(vm->mapCacheMutex);
+				vm->mapCacheMutex = NULL;
+			}
 
 			if (vm->jimageIntf) {
 				closeJImageIntf(vm->jimageIntf);
@@ -241,12 +247,14 @@ j9bcutil_verifyCanonisizeAndCopyUTF8 (U_8 *dest, U_8 *source, U_32 length)
 
 	while (source != sourceEnd) {
 
-		/* Handle multibyte */
-		if (((UDATA) ((*source++) - 1)) < 0x7F) {
-			continue;
+		/* Skip the run of single byte characters, which need neither checks nor compression */
+		source += countUTF8SingleByteChars(source, (UDATA)(sourceEnd - source));
+		if (source == sourceEnd) {
+			break;
 		}
 
-		firstByte = *(source - 1);
+		/* Handle multibyte */
+		firstByte = *source++;
 		if (firstByte == 0) {
 			Trc_BCU_verifyCanonisizeAndCopyUTF8_FailedFirstByteZero();
 			goto fail;
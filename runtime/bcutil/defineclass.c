@@ -841,6 +841,21 @@ createROMClassFromClassFile(J9VMThread *currentThread, J9LoadROMClassData *loadD
 		return romClass;
 	}
 
+	if (BCT_ERR_CLASS_ALREADY_DEFINED == result) {
+		/* Another thread defined the class while the class file was parsed outside the classTableMutex.
+		 * Class path loads keep the mutex while parsing (see J9_FINDCLASS_FLAG_LOCALLY_DEFINED).
+		 */
+		Trc_BCU_Assert_True(J9_ARE_NO_BITS_SET(loadData->options, J9_FINDCLASS_FLAG_LOCALLY_DEFINED));
+		/* defineClass() reports a duplicate definition with a LinkageError, other callers get the
+		 * NoClassDefFoundError of checkForExistingClass(). The message is the class name.
+		 */
+		if (J9_ARE_ANY_BITS_SET(loadData->options, J9_FINDCLASS_FLAG_NO_CHECK_FOR_EXISTING_CLASS)) {
+			exceptionNumber = J9VMCONSTANTPOOL_JAVALANGLINKAGEERROR;
+		} else {
+			exceptionNumber = J9VMCONSTANTPOOL_JAVALANGNOCLASSDEFFOUNDERROR;
+		}
+	}
+
 	/* Always throw load errors */
 
 	Trc_BCU_Assert_True(NULL != vm->dynamicLoadBuffers);
@@ -552,6 +552,7 @@ readFile (J9JavaVM * javaVM) {
 	if ((U_32) bytesRead != fileSize) {
 		goto _failedFileRead;
 	}
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = fileSize;
 	j9file_close(fd);
 	return 0;
@@ -584,6 +585,7 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	I_32 result;
 	U_32 size;
 	IDATA filenameLength;
+	U_8 *data = NULL;
 
 	zipFile = (VMIZipFile *) (cpEntry->extraInfo);
 
@@ -598,6 +600,17 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 	}
 
 	size = entry.uncompressedSize;
+
+	/* Stored entries are parsed in place from the mapped zip file, only compressed ones are inflated */
+	if (J9_ARE_NO_BITS_SET(javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING)
+		&& (0 == zipFunctions->zip_getZipEntryDataPointer (VMI, zipFile, &entry, &data))
+	) {
+		javaVM->dynamicLoadBuffers->currentSunClassFileData = data;
+		javaVM->dynamicLoadBuffers->currentSunClassFileSize = size;
+		result = 0;
+		goto finished;
+	}
+
 	if (checkSunClassFileBuffers(javaVM, size)) {
 		/* Out of memory. */
 		result = -1;
@@ -611,6 +624,7 @@ readZip (J9JavaVM * javaVM, J9ClassPathEntry * cpEntry) {
 		goto finished;
 	}
 
+	javaVM->dynamicLoadBuffers->currentSunClassFileData = javaVM->dynamicLoadBuffers->sunClassFileBuffer;
 	javaVM->dynamicLoadBuffers->currentSunClassFileSize = size;
 
   finished:
@@ -645,14 +659,24 @@ readFileFromJImage (J9VMThread *vmThread, J9Module *j9module, U_8 *moduleName, J
 
 	rc = jimageIntf->jimageFindResource(jimageIntf, jimageHandle, (const char *)moduleName, resourceName, &resourceLocation, &size);
 	if (J9JIMAGE_NO_ERROR == rc) {
+		U_8 *data = NULL;
+
 		Trc_BCU_readFileFromJImage_LookupPassed_V1(moduleName, resourceName);
-		if (checkSunClassFileBuffers(javaVM, (U_32)size)) {
+		if (J9_ARE_NO_BITS_SET(javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING)
+			&& (J9JIMAGE_NO_ERROR == jimageIntf->jimageMapResource(jimageIntf, jimageHandle, resourceLocation, &data))
+		) {
+			/* Uncompressed resources are parsed in place from the mapped jimage file */
+			dynamicLoadBuffers->currentSunClassFileData = data;
+			dynamicLoadBuffers->currentSunClassFileSize = (UDATA)size;
+			rc = 0;
+		} else if (checkSunClassFileBuffers(javaVM, (U_32)size)) {
 			/* Out of memory. */
 			Trc_BCU_readFileFromJImage_BufferAllocationFailed_V1(moduleName, resourceName, size);
 			rc = -1;
 		} else {
 			rc = jimageIntf->jimageGetResource(jimageIntf, jimageHandle, resourceLocation, (char *)dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->sunClassFileSize, NULL);
 			if (J9JIMAGE_NO_ERROR == rc) {
+				dynamicLoadBuffers->currentSunClassFileData = dynamicLoadBuffers->sunClassFileBuffer;
 				dynamicLoadBuffers->currentSunClassFileSize = (UDATA)size;
 				rc = 0;
 			} else {
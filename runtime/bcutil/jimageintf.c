@@ -171,6 +171,7 @@ initJImageIntfCommon(J9JImageIntf **jimageIntf, J9JavaVM *vm, J9PortLibrary *por
 		intf->jimageFreeResourceLocation = jimageFreeResourceLocation;
 		intf->jimageGetResource = jimageGetResource;
 		intf->jimagePackageToModule = jimagePackageToModule;
+		intf->jimageMapResource = jimageMapResource;
 
 		 *jimageIntf = intf;
 	} else {
@@ -411,6 +412,24 @@ jimageGetResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation
 	return rc;
 }
 
+I_32
+jimageMapResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, U_8 **data)
+{
+	I_32 rc = J9JIMAGE_RESOURCE_NOT_MAPPED;
+	PORT_ACCESS_FROM_PORT(jimageIntf->portLib);
+
+	Trc_BCU_Assert_True(NULL != data);
+
+	/* libjimage only hands out copies of the resources */
+	if (0 == jimageIntf->libJImageHandle) {
+		J9JImage *jimage = (J9JImage *)handle;
+		J9JImageLocation *j9jimageLocation = (J9JImageLocation *)resourceLocation;
+
+		rc = j9bcutil_mapJImageResource(PORTLIB, jimage, j9jimageLocation, data);
+	}
+	return rc;
+}
+
 const char *
 jimagePackageToModule(J9JImageIntf *jimageIntf, UDATA handle, const char *packageName)
 {
@@ -658,6 +658,50 @@ _end:
 	return rc;
 }
 
+I_32
+j9bcutil_mapJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, U_8 **data)
+{
+	J9MmapHandle *resourcesMmap = NULL;
+	I_32 rc = J9JIMAGE_NO_ERROR;
+
+	PORT_ACCESS_FROM_PORT(portlib);
+
+	Trc_BCU_mapJImageResource_Entry(jimage->fileName, j9jimageLocation->resourceOffset, j9jimageLocation->uncompressedSize);
+
+	if ((0 != j9jimageLocation->compressedSize) || (jimage->fileLength > (U_64)UDATA_MAX)) {
+		/* compressed resources must be inflated, and a file larger than the address space cannot be mapped */
+		rc = J9JIMAGE_RESOURCE_NOT_MAPPED;
+		goto _end;
+	}
+	if ((j9jimageLocation->resourceOffset + j9jimageLocation->uncompressedSize) > jimage->fileLength) {
+		rc = J9JIMAGE_INVALID_RESOURCE_OFFSET;
+		goto _end;
+	}
+
+	resourcesMmap = jimage->resourcesMmap;
+	if (NULL == resourcesMmap) {
+		/* Map the whole file once; only the pages of the resources actually read become resident */
+		resourcesMmap = j9mmap_map_file(jimage->fd, 0, (UDATA)jimage->fileLength, jimage->fileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_CLASSES);
+		if (NULL == resourcesMmap) {
+			I_32 portlibErrCode = j9error_last_error_number();
+			const char *portlibErrMsg = j9error_last_error_message();
+			Trc_BCU_mapJImageResource_JImageMmapFailed((UDATA)jimage->fileLength, jimage->fileName, portlibErrCode, portlibErrMsg);
+			rc = J9JIMAGE_MAP_FAILED;
+			goto _end;
+		}
+		if (0 != compareAndSwapUDATA((uintptr_t *)&jimage->resourcesMmap, 0, (uintptr_t)resourcesMmap)) {
+			/* another thread installed its mapping first */
+			j9mmap_unmap_file(resourcesMmap);
+			resourcesMmap = jimage->resourcesMmap;
+		}
+	}
+	*data = (U_8 *)resourcesMmap->pointer + j9jimageLocation->resourceOffset;
+
+_end:
+	Trc_BCU_mapJImageResource_Exit(jimage->fileName, rc);
+	return rc;
+}
+
 I_32
 j9bcutil_getJImageResourceName(J9PortLibrary *portlib, J9JImage *jimage, const char *module, const char *parent, const char *base, const char *extension, char **resourceName)
 {
@@ -821,6 +865,10 @@ j9bcutil_unloadJImage(J9PortLibrary *portlib, J9JImage *jimage)
 			j9mmap_unmap_file(jimage->jimageMmap);
 			jimage->jimageMmap = NULL;
 		}
+		if (NULL != jimage->resourcesMmap) {
+			j9mmap_unmap_file(jimage->resourcesMmap);
+			jimage->resourcesMmap = NULL;
+		}
 		if (-1 != jimage->fd) {
 			j9file_close(jimage->fd);
 			jimage->fd = -1;
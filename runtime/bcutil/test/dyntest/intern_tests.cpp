@@ -47,8 +47,11 @@ static void freeJ9SharedInvariantInternTable(J9PortLibrary *portLib, J9SharedInv
 static IDATA testStringInternTableWithZeroSize(J9PortLibrary *portLib);
 static IDATA testStringInternTableWithSize1(J9PortLibrary *portLib);
 static IDATA testStringInternTableRemoveLocalNodesWithDeadClassLoaders(J9PortLibrary *portLib);
+static IDATA testStringInternTableLRUEviction(J9PortLibrary *portLib);
 static IDATA testStringInternTableStressLocal(J9PortLibrary *portLib, UDATA numIterations);
 static IDATA testStringInternTableStressShared(J9PortLibrary *portLib, UDATA numIterations);
+static IDATA testUTF8SingleByteScan(J9PortLibrary *portLib);
+static IDATA testUTF8HashForBytes(J9PortLibrary *portLib);
 
 
 static J9UTF8 *
@@ -613,6 +616,90 @@ _exit_test:
 }
 
 
+static IDATA
+testStringInternTableLRUEviction(J9PortLibrary *portLib)
+{
+	const char * testName = "testStringInternTableLRUEviction";
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	/* Note: Only the address of the classLoader is used for intern matching, so this dummy one will do. */
+	J9ClassLoader dummyClassLoader;
+	J9UTF8 *utf8s[3] = { NULL, NULL, NULL };
+	const char *utf8StringData[3] = { "Robin", "Alfred", "Gordon" };
+	bool expectedFound[3] = { true, false, true };
+	J9InternSearchInfo searchInfo;
+	J9InternSearchResult searchResult;
+	bool found;
+
+	reportTestEntry(PORTLIB, testName);
+
+	StringInternTable stringInternTable(NULL, portLib, 2);
+	if (!stringInternTable.isOK()) {
+		outputErrorMessage(TEST_ERROR_ARGS, "stringInternTable.isOK() failed!\n");
+		goto _exit_test;
+	}
+
+	for (UDATA i = 0; i < 3; i++) {
+		utf8s[i] = portAllocUTF8(portLib, utf8StringData[i]);
+		if (NULL == utf8s[i]) {
+			outputErrorMessage(TEST_ERROR_ARGS, "portAllocUTF8() failed!\n");
+			goto _exit_test;
+		}
+	}
+
+	searchInfo.classloader = &dummyClassLoader;
+	searchInfo.sharedCacheSRPRangeInfo = SC_COMPLETELY_OUT_OF_THE_SRP_RANGE;
+
+	stringInternTable.internUtf8(utf8s[0], &dummyClassLoader);
+	stringInternTable.internUtf8(utf8s[1], &dummyClassLoader);
+
+	/* Use the least recently interned node, so that the second one is evicted in its place. */
+	searchInfo.stringData = (U_8*)utf8StringData[0];
+	searchInfo.stringLength = J9UTF8_LENGTH(utf8s[0]);
+	searchInfo.romClassBaseAddr = (U_8*)utf8s[0] + 10;
+	searchInfo.romClassEndAddr = (U_8*)utf8s[0] + 20;
+	found = stringInternTable.findUtf8(&searchInfo, NULL, /* isSharedROMClass = */ false, &searchResult);
+	if (!found) {
+		outputErrorMessage(TEST_ERROR_ARGS, "stringInternTable.findUtf8() returned false!\n");
+		goto _exit_test;
+	}
+	stringInternTable.markNodeAsUsed(&searchResult, NULL);
+
+	stringInternTable.internUtf8(utf8s[2], &dummyClassLoader);
+	if (!stringInternTable.verify(__FILE__, __LINE__)) {
+		outputErrorMessage(TEST_ERROR_ARGS, "stringInternTable.verify() failed!\n");
+		goto _exit_test;
+	}
+
+	for (UDATA i = 0; i < 3; i++) {
+		searchInfo.stringData = (U_8*)utf8StringData[i];
+		searchInfo.stringLength = J9UTF8_LENGTH(utf8s[i]);
+		searchInfo.romClassBaseAddr = (U_8*)utf8s[i] + 10;
+		searchInfo.romClassEndAddr = (U_8*)utf8s[i] + 20;
+		found = stringInternTable.findUtf8(&searchInfo, NULL, /* isSharedROMClass = */ false, &searchResult);
+		if (expectedFound[i] != found) {
+			outputErrorMessage(TEST_ERROR_ARGS, "stringInternTable.findUtf8() returned %d for %s!\n", found, utf8StringData[i]);
+			goto _exit_test;
+		}
+	}
+
+	/* Lookups are counted by the ROMClass builder and added once per class. */
+	stringInternTable.addLookupCounts(4, 3, 0);
+	stringInternTable.addLookupCounts(2, 1, 1);
+	if ((6 != stringInternTable.lookupCount()) || (4 != stringInternTable.localHitCount()) || (1 != stringInternTable.sharedHitCount())) {
+		outputErrorMessage(TEST_ERROR_ARGS, "unexpected lookup counts (lookups %zu, local hits %zu, shared hits %zu)!\n",
+			stringInternTable.lookupCount(), stringInternTable.localHitCount(), stringInternTable.sharedHitCount());
+		goto _exit_test;
+	}
+
+_exit_test:
+	for (UDATA i = 0; i < 3; i++) {
+		j9mem_free_memory(utf8s[i]);
+	}
+	return reportTestExit(PORTLIB, testName);
+}
+
+
 static IDATA
 testStringInternTableStressLocal(J9PortLibrary *portLib, UDATA numIterations)
 {
@@ -875,6 +962,201 @@ _exit_test:
 }
 
 
+/* Bytes placed into otherwise single byte runs to stop the scan. */
+static const U_8 utf8ScanStopBytes[] = { 0x00, 0x80, 0xC3, 0xE2, 0xFF };
+
+/* Valid multi-byte encodings, including the two byte encoding of NUL, placed into single byte runs. */
+static const char * const utf8HashEncodings[] = { "\xC0\x80", "\xC3\xA9", "\xE2\x82\xAC", "\xEF\xBF\xBF" };
+
+#define UTF8_TEST_MAX_LENGTH 64
+#define UTF8_TEST_MAX_MISALIGNMENT 16
+
+
+static UDATA
+scalarCountUTF8SingleByteChars(const U_8 *data, UDATA length)
+{
+	UDATA count = 0;
+
+	while ((count < length) && (data[count] >= 0x01) && (data[count] <= 0x7F)) {
+		count++;
+	}
+	return count;
+}
+
+
+static UDATA
+scalarHashForBytes(UDATA hash, const U_8 *data, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		hash = (hash << 5) - hash + data[i];
+	}
+	return hash;
+}
+
+
+static UDATA
+scalarHashForUTF8(const U_8 *data, UDATA length)
+{
+	UDATA hash = 0;
+	const U_8 *end = data + length;
+
+	while (data < end) {
+		U_16 c = 0;
+
+		data += decodeUTF8Char(data, &c);
+		hash = (hash << 5) - hash + c;
+	}
+	return hash;
+}
+
+
+/* Fills data[0..length-1] with single byte characters which differ between neighbouring bytes. */
+static void
+fillSingleByteChars(U_8 *data, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		data[i] = U_8(0x01 + ((i * 37) % 0x7F));
+	}
+}
+
+
+static IDATA
+testUTF8SingleByteScan(J9PortLibrary *portLib)
+{
+	const char * testName = "testUTF8SingleByteScan";
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	U_8 buffer[UTF8_TEST_MAX_MISALIGNMENT + UTF8_TEST_MAX_LENGTH];
+	const UDATA stopBytesCount = sizeof(utf8ScanStopBytes)/sizeof(utf8ScanStopBytes[0]);
+
+	reportTestEntry(PORTLIB, testName);
+
+	for (UDATA misalignment = 0; misalignment < UTF8_TEST_MAX_MISALIGNMENT; misalignment++) {
+		U_8 *data = buffer + misalignment;
+
+		for (UDATA length = 0; length <= UTF8_TEST_MAX_LENGTH; length++) {
+			/* stopIndex == length leaves the whole run single byte */
+			for (UDATA stopIndex = 0; stopIndex <= length; stopIndex++) {
+				for (UDATA stopByte = 0; stopByte < stopBytesCount; stopByte++) {
+					fillSingleByteChars(data, length);
+					if (stopIndex < length) {
+						data[stopIndex] = utf8ScanStopBytes[stopByte];
+					}
+					/* the byte just past the end must not be looked at */
+					if (length < UTF8_TEST_MAX_LENGTH) {
+						data[length] = 'x';
+					}
+
+					UDATA expected = scalarCountUTF8SingleByteChars(data, length);
+					UDATA actual = countUTF8SingleByteChars(data, length);
+					if (expected != actual) {
+						outputErrorMessage(TEST_ERROR_ARGS, "countUTF8SingleByteChars() returned %zu, expected %zu (misalignment %zu, length %zu, byte 0x%x at %zu)\n",
+								actual, expected, misalignment, length, utf8ScanStopBytes[stopByte], stopIndex);
+						goto _exit_test;
+					}
+					if (stopIndex == length) {
+						break;
+					}
+				}
+			}
+		}
+	}
+
+_exit_test:
+	return reportTestExit(PORTLIB, testName);
+}
+
+
+static IDATA
+testUTF8HashForBytes(J9PortLibrary *portLib)
+{
+	const char * testName = "testUTF8HashForBytes";
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	U_8 buffer[UTF8_TEST_MAX_MISALIGNMENT + UTF8_TEST_MAX_LENGTH];
+	const UDATA stopBytesCount = sizeof(utf8ScanStopBytes)/sizeof(utf8ScanStopBytes[0]);
+	const UDATA encodingsCount = sizeof(utf8HashEncodings)/sizeof(utf8HashEncodings[0]);
+	/* a seed with high bits set, as the StringInternTable seeds the hash with the class loader address */
+	const UDATA seed = (UDATA)J9CONST64(0x9E3779B97F4A7C15);
+
+	reportTestEntry(PORTLIB, testName);
+
+	for (UDATA misalignment = 0; misalignment < UTF8_TEST_MAX_MISALIGNMENT; misalignment++) {
+		U_8 *data = buffer + misalignment;
+
+		for (UDATA length = 0; length <= UTF8_TEST_MAX_LENGTH; length++) {
+			/* computeHashForBytes() and sharedInternHashFn() treat every byte as one character, whatever its value */
+			for (UDATA index = 0; index <= length; index++) {
+				for (UDATA stopByte = 0; stopByte < stopBytesCount; stopByte++) {
+					fillSingleByteChars(data, length);
+					if (index < length) {
+						data[index] = utf8ScanStopBytes[stopByte];
+					}
+
+					UDATA expected = scalarHashForBytes(0, data, length);
+					UDATA actual = computeHashForBytes(0, data, length);
+					if (expected != actual) {
+						outputErrorMessage(TEST_ERROR_ARGS, "computeHashForBytes() returned 0x%zx, expected 0x%zx (misalignment %zu, length %zu)\n",
+								actual, expected, misalignment, length);
+						goto _exit_test;
+					}
+
+					J9SharedInternHashTableQuery query;
+					query.length = length;
+					query.data = data;
+					actual = sharedInternHashFn(&query, NULL);
+					if (expected != actual) {
+						outputErrorMessage(TEST_ERROR_ARGS, "sharedInternHashFn() returned 0x%zx, expected 0x%zx (misalignment %zu, length %zu)\n",
+								actual, expected, misalignment, length);
+						goto _exit_test;
+					}
+
+					expected = scalarHashForBytes(seed, data, length);
+					actual = computeHashForBytes(seed, data, length);
+					if (expected != actual) {
+						outputErrorMessage(TEST_ERROR_ARGS, "seeded computeHashForBytes() returned 0x%zx, expected 0x%zx (misalignment %zu, length %zu)\n",
+								actual, expected, misalignment, length);
+						goto _exit_test;
+					}
+					if (index == length) {
+						break;
+					}
+				}
+			}
+
+			/* computeHashForUTF8() must hash single byte runs the same as decoding them one character at a time */
+			for (UDATA index = 0; index <= length; index++) {
+				for (UDATA encoding = 0; encoding < encodingsCount; encoding++) {
+					UDATA encodingLength = strlen(utf8HashEncodings[encoding]);
+
+					fillSingleByteChars(data, length);
+					if (index < length) {
+						if ((index + encodingLength) > length) {
+							break;
+						}
+						memcpy(data + index, utf8HashEncodings[encoding], encodingLength);
+					}
+
+					UDATA expected = scalarHashForUTF8(data, length);
+					UDATA actual = computeHashForUTF8(data, length);
+					if (expected != actual) {
+						outputErrorMessage(TEST_ERROR_ARGS, "computeHashForUTF8() returned 0x%zx, expected 0x%zx (misalignment %zu, length %zu, encoding %zu at %zu)\n",
+								actual, expected, misalignment, length, encoding, index);
+						goto _exit_test;
+					}
+					if (index == length) {
+						break;
+					}
+				}
+			}
+		}
+	}
+
+_exit_test:
+	return reportTestExit(PORTLIB, testName);
+}
+
+
 extern "C" {
 IDATA
 j9dyn_testInterning(J9PortLibrary *portLib, int randomSeed)
@@ -894,9 +1176,12 @@ j9dyn_testInterning(J9PortLibrary *portLib, int randomSeed)
 	rc |= testStringInternTableWithZeroSize(PORTLIB);
 	rc |= testStringInternTableWithSize1(PORTLIB);
 	rc |= testStringInternTableRemoveLocalNodesWithDeadClassLoaders(PORTLIB);
+	rc |= testStringInternTableLRUEviction(PORTLIB);
 	rc |= testStringInternTableStressLocal(PORTLIB, 10000);
 	rc |= testStringInternTableStressShared(PORTLIB, 10000);
 	rc |= testStringInternTableSRPRangeCheck(PORTLIB);
+	rc |= testUTF8SingleByteScan(PORTLIB);
+	rc |= testUTF8HashForBytes(PORTLIB);
 
 
 	return rc;
@@ -70,6 +70,7 @@
 #define OPT_BOOTCLASSPATH_STATIC "bootclasspathstatic"
 #define OPT_DO_PROTECTED_ACCESS_CHECK "doProtectedAccessCheck"
 
+static J9BytecodeVerificationData * allocateVerificationData (J9JavaVM* javaVM);
 static IDATA buildBranchMap (J9BytecodeVerificationData * verifyData);
 static IDATA decompressStackMaps (J9BytecodeVerificationData * verifyData, IDATA localsCount, U_8 * stackMapData);
 static VMINLINE IDATA parseLocals (J9BytecodeVerificationData * verifyData, U_8** stackMapData, J9BranchTargetStack * liveStack, IDATA localDelta, IDATA localsCount, IDATA maxLocals);
@@ -2280,8 +2281,19 @@ j9bcv_freeVerificationData (J9PortLibrary * portLib, J9BytecodeVerificationData
 		(*jniVM)->GetEnv(jniVM, (void**)&threadEnv, J9THREAD_VERSION_1_1);
 
 		threadEnv->monitor_destroy( verifyData->verifierMutex );
+		if (NULL != verifyData->contextPoolMutex) {
+			threadEnv->monitor_destroy( verifyData->contextPoolMutex );
+		}
 #endif
+		while (NULL != verifyData->freeContexts) {
+			J9BytecodeVerificationData *context = verifyData->freeContexts;
+			verifyData->freeContexts = context->nextContext;
+			/* The exclude attribute is owned by the VM wide verification data */
+			context->excludeAttribute = NULL;
+			j9bcv_freeVerificationData(portLib, context);
+		}
 		freeVerifyBuffers( PORTLIB, verifyData );
+		j9mem_free_memory( verifyData->dependencyRecord );
 		j9mem_free_memory( verifyData->excludeAttribute );
 		j9mem_free_memory( verifyData );
 	}
@@ -2291,8 +2303,8 @@ j9bcv_freeVerificationData (J9PortLibrary * portLib, J9BytecodeVerificationData
  * returns J9BytecodeVerificationData* on success
  * returns NULL on OOM
  */
-J9BytecodeVerificationData *  
-j9bcv_initializeVerificationData(J9JavaVM* javaVM)
+static J9BytecodeVerificationData *  
+allocateVerificationData(J9JavaVM* javaVM)
 {
 	J9BytecodeVerificationData * verifyData;
 	PORT_ACCESS_FROM_JAVAVM(javaVM);
@@ -2309,6 +2321,13 @@ j9bcv_initializeVerificationData(J9JavaVM* javaVM)
 	/* blank the vmStruct field */
 	verifyData->vmStruct = NULL;
 	verifyData->javaVM = javaVM;
+	verifyData->nextContext = NULL;
+	verifyData->freeContexts = NULL;
+	verifyData->contextPoolMutex = NULL;
+	verifyData->recordDependencies = FALSE;
+	verifyData->dependencyRecord = NULL;
+	verifyData->dependencyRecordSize = 0;
+	verifyData->dependencyRecordUsed = 0;
 
 #ifdef J9VM_THR_PREEMPTIVE
 	threadEnv->monitor_init_with_name(&verifyData->verifierMutex, 0, "BCVD verifier");
@@ -2345,6 +2364,91 @@ error_no_memory:
 	return NULL;
 }
 
+/*
+ * returns J9BytecodeVerificationData* on success
+ * returns NULL on OOM
+ */
+J9BytecodeVerificationData *  
+j9bcv_initializeVerificationData(J9JavaVM* javaVM)
+{
+	J9BytecodeVerificationData * verifyData = allocateVerificationData(javaVM);
+
+#ifdef J9VM_THR_PREEMPTIVE
+	if (NULL != verifyData) {
+		JavaVM* jniVM = (JavaVM*)javaVM;
+		J9ThreadEnv* threadEnv;
+
+		(*jniVM)->GetEnv(jniVM, (void**)&threadEnv, J9THREAD_VERSION_1_1);
+		threadEnv->monitor_init_with_name(&verifyData->contextPoolMutex, 0, "BCVD verification contexts");
+		if (NULL == verifyData->contextPoolMutex) {
+			j9bcv_freeVerificationData(javaVM->portLibrary, verifyData);
+			verifyData = NULL;
+		}
+	}
+#endif
+
+	return verifyData;
+}
+
+/*
+ * Verification contexts let classes be verified on several threads at once. Each context has its
+ * own buffers and verifierMutex, and is configured from the VM wide verification data, which keeps
+ * the contexts that are not in use.
+ *
+ * returns J9BytecodeVerificationData* on success
+ * returns NULL on OOM, in which case the caller falls back to the VM wide verification data
+ */
+J9BytecodeVerificationData *
+j9bcv_acquireVerificationContext(J9VMThread* currentThread)
+{
+	J9JavaVM *javaVM = currentThread->javaVM;
+	J9BytecodeVerificationData *vmVerifyData = javaVM->bytecodeVerificationData;
+	J9BytecodeVerificationData *context = NULL;
+
+	if (NULL == vmVerifyData->contextPoolMutex) {
+		return NULL;
+	}
+
+	omrthread_monitor_enter(vmVerifyData->contextPoolMutex);
+	context = vmVerifyData->freeContexts;
+	if (NULL != context) {
+		vmVerifyData->freeContexts = context->nextContext;
+		context->nextContext = NULL;
+	}
+	omrthread_monitor_exit(vmVerifyData->contextPoolMutex);
+
+	if (NULL == context) {
+		context = allocateVerificationData(javaVM);
+		Trc_BCV_j9bcv_acquireVerificationContext_Allocated(currentThread, context);
+	}
+
+	if (NULL != context) {
+		context->verifyBytecodesFunction = vmVerifyData->verifyBytecodesFunction;
+		context->checkClassLoadingConstraintForNameFunction = vmVerifyData->checkClassLoadingConstraintForNameFunction;
+		context->verificationFlags = vmVerifyData->verificationFlags;
+		context->ignoreStackMaps = vmVerifyData->ignoreStackMaps;
+		context->excludeAttribute = vmVerifyData->excludeAttribute;
+	}
+
+	return context;
+}
+
+/*
+ * Return a context obtained from j9bcv_acquireVerificationContext for reuse by another verification.
+ */
+void
+j9bcv_releaseVerificationContext(J9VMThread* currentThread, J9BytecodeVerificationData *context)
+{
+	J9BytecodeVerificationData *vmVerifyData = currentThread->javaVM->bytecodeVerificationData;
+
+	context->vmStruct = NULL;
+	context->classLoader = NULL;
+	omrthread_monitor_enter(vmVerifyData->contextPoolMutex);
+	context->nextContext = vmVerifyData->freeContexts;
+	vmVerifyData->freeContexts = context;
+	omrthread_monitor_exit(vmVerifyData->contextPoolMutex);
+}
+
 
 
 #define ALLOC_BUFFER(name, needed) \
@@ -2405,6 +2509,11 @@ j9bcv_verifyBytecodes (J9PortLibrary * portLib, J9Class * clazz, J9ROMClass * ro
 	
 	verifyData->romClassInSharedClasses = j9shr_Query_IsAddressInCache(verifyData->javaVM, romClass, romClass->romSize);
 
+	/* A shared class verified by an earlier VM need not be verified again if the classes it depends on are unchanged */
+	if (j9bcv_checkVerifiedClassRecord(verifyData, clazz, romClass)) {
+		goto _done;
+	}
+
 	/* List is used for the whole class */
 	initializeClassNameList(verifyData);
 
@@ -2614,6 +2723,10 @@ _fallBack:
 	}
 
 _done:
+	if (BCV_SUCCESS == result) {
+		j9bcv_storeVerifiedClassRecord(verifyData, romClass);
+	}
+	verifyData->recordDependencies = FALSE;
 	verifyData->vmStruct->omrVMThread->vmState = oldState;
 	if (result == BCV_ERR_INSUFFICIENT_MEMORY) {
 		Trc_BCV_j9bcv_verifyBytecodes_OutOfMemory(verifyData->vmStruct, 
@@ -53,6 +53,38 @@ extern "C" {
 void
 storeVerifyErrorData (J9BytecodeVerificationData * verifyData, I_16 errorDetailCode, U_32 errorCurrentFramePosition, UDATA errorTargetType, UDATA errorTempData, IDATA currentPC);
 
+/* ---------------- verifiedclasses.c ---------------- */
+
+/**
+ * Look for a record of an earlier successful verification of a shared ROM class whose dependencies
+ * match the classes loaded in verifyData->classLoader. If there is no record, start recording the
+ * dependencies of this verification.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param clazz - the class being verified
+ * @param romClass - the ROM class being verified
+ * @return TRUE if the class need not be verified again, FALSE otherwise
+ */
+BOOLEAN
+j9bcv_checkVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass);
+
+/**
+ * Record a class resolved by name during verification.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param className - the name the class was resolved by
+ * @param nameLength - length of className
+ * @param ramClass - the resolved class
+ */
+void
+j9bcv_recordVerifiedClassDependency(J9BytecodeVerificationData *verifyData, U_8 *className, UDATA nameLength, J9Class *ramClass);
+
+/**
+ * Store the dependencies recorded during a successful verification in the shared classes cache.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param romClass - the ROM class which was verified
+ */
+void
+j9bcv_storeVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9ROMClass *romClass);
+
 #ifdef __cplusplus
 }
 #endif
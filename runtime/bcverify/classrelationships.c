@@ -51,6 +51,9 @@ j9bcv_recordClassRelationship(J9VMThread *vmThread, J9ClassLoader *classLoader,
 
 	Assert_RTV_true((NULL != childName) && (NULL != parentName));
 
+	/* Relationships are recorded by concurrent verifications, and validated during class initialization */
+	omrthread_monitor_enter(vm->classTableMutex);
+
 	/* Locate existing childEntry or add new entry to the hashtable */
 	childEntry = findClassRelationship(vmThread, classLoader, childName, childNameLength);
 
@@ -136,6 +139,7 @@ j9bcv_recordClassRelationship(J9VMThread *vmThread, J9ClassLoader *classLoader,
 	*reasonCode = 0;
 
 recordDone:
+	omrthread_monitor_exit(vm->classTableMutex);
 	Trc_RTV_recordClassRelationship_Exit(vmThread, recordResult);
 	return recordResult;
 }
@@ -156,6 +160,7 @@ j9bcv_validateClassRelationships(J9VMThread *vmThread, J9ClassLoader *classLoade
 
 	Trc_RTV_validateClassRelationships_Entry(vmThread, childNameLength, childName);
 	Assert_RTV_true(NULL != childName);
+	omrthread_monitor_enter(vmThread->javaVM->classTableMutex);
 	childEntry = findClassRelationship(vmThread, classLoader, childName, childNameLength);
 
 	/* No relationships were recorded for the class (in this class loader), or its relationships have already been verified */
@@ -254,6 +259,7 @@ j9bcv_validateClassRelationships(J9VMThread *vmThread, J9ClassLoader *classLoade
 	hashTableRemove(classLoader->classRelationshipsHashTable, childEntry);
 
 validateDone:
+	omrthread_monitor_exit(vmThread->javaVM->classTableMutex);
 	Trc_RTV_validateClassRelationships_Exit(vmThread, failedClass);
 	return failedClass;
 }
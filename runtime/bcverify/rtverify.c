@@ -144,6 +144,10 @@ j9rtv_verifierGetRAMClass( J9BytecodeVerificationData *verifyData, J9ClassLoader
 		Trc_RTV_j9rtv_verifierGetRAMClass_found(verifyData->vmStruct);
 	}
 
+	if (NULL != found) {
+		j9bcv_recordVerifiedClassDependency(verifyData, className, nameLength, found);
+	}
+
 	Trc_RTV_j9rtv_verifierGetRAMClass_Exit(verifyData->vmStruct);
 
 	return found;
@@ -0,0 +1,386 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "bcverify_internal.h"
+#include "SCQueryFunctions.h"
+#include "ut_j9bcverify.h"
+
+/*
+ * Verified class records.
+ *
+ * When a ROM class in the shared classes cache verifies successfully, a record is attached to it
+ * in the cache listing every class the verifier resolved by name. Each resolved class is identified
+ * by the ROM classes of its superclass chain, as the cache layer holding each one and its offset in
+ * that layer, and whether each was defined by the verifying class loader, which is all of the loaded
+ * classes the verifier looks at. A later verification of the same ROM class is skipped when every dependency is already
+ * loaded in the verifying class loader and matches the record.
+ *
+ * Layers are numbered from the lowest one, so the numbers do not change when a VM adds a layer on
+ * top, and an offset within a layer is the same in every VM although the layers are mapped at
+ * different addresses.
+ *
+ * Dependencies which are not yet loaded are not loaded to check the record, the class is verified.
+ * Classes verified with -XX:+ClassRelationshipVerifier are never recorded, as the relationships
+ * which were not checked against loaded classes would not be recorded in the class loader.
+ */
+
+#define VERIFIED_RECORD_INITIAL_SIZE 1024
+
+typedef struct J9VerifiedClassRecord {
+	U_32 verificationFlags;
+	U_32 xfuture;
+	U_32 dependencyCount;
+	U_32 reserved;
+} J9VerifiedClassRecord;
+
+/* Followed by chainLength J9VerifiedClassChainEntry, then the name padded to a UDATA boundary */
+typedef struct J9VerifiedClassDependency {
+	U_32 nameLength;
+	U_32 chainLength;
+} J9VerifiedClassDependency;
+
+/* The first entry is the resolved class itself, followed by its superclasses from the nearest */
+typedef struct J9VerifiedClassChainEntry {
+	UDATA layer;
+	UDATA romClassOffset;
+	UDATA romSize;
+	UDATA sameLoader;
+} J9VerifiedClassChainEntry;
+
+#define VERIFIED_DEPENDENCY_CHAIN(dependency) ((J9VerifiedClassChainEntry *)((J9VerifiedClassDependency *)(dependency) + 1))
+#define VERIFIED_DEPENDENCY_NAME(dependency) ((U_8 *)(VERIFIED_DEPENDENCY_CHAIN(dependency) + (dependency)->chainLength))
+#define VERIFIED_DEPENDENCY_SIZE(nameLength, chainLength) \
+	(sizeof(J9VerifiedClassDependency) + ((chainLength) * sizeof(J9VerifiedClassChainEntry)) + ROUND_UP_TO_POWEROF2((UDATA)(nameLength), sizeof(UDATA)))
+
+static BOOLEAN canUseVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass);
+static J9Class *chainClassAt(J9Class *ramClass, UDATA index);
+static J9SharedClassCacheDescriptor *cacheLayerContaining(J9JavaVM *vm, J9ROMClass *romClass, UDATA *layer);
+static J9SharedClassCacheDescriptor *cacheLayerAt(J9JavaVM *vm, UDATA layer);
+static BOOLEAN dependencyMatches(J9BytecodeVerificationData *verifyData, J9VerifiedClassDependency *dependency);
+
+
+/*
+ * Records can only be used for unmodified ROM classes in the shared classes cache, verified
+ * with a verification context for a class loader.
+ */
+static BOOLEAN
+canUseVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass)
+{
+	J9JavaVM *vm = verifyData->javaVM;
+	J9SharedClassConfig *sharedClassConfig = vm->sharedClassConfig;
+
+	return (NULL != clazz)
+		&& (NULL != sharedClassConfig)
+		&& (NULL != sharedClassConfig->findAttachedData)
+		&& (NULL != sharedClassConfig->storeAttachedData)
+		&& (NULL != sharedClassConfig->freeAttachedDataDescriptor)
+		&& (NULL != sharedClassConfig->cacheDescriptorList)
+		&& verifyData->romClassInSharedClasses
+		&& (verifyData != vm->bytecodeVerificationData)
+		&& (0 == verifyData->redefinedClassesCount)
+		&& !J9ROMCLASS_HAS_MODIFIED_BYTECODES(romClass)
+		&& J9_ARE_NO_BITS_SET(verifyData->verificationFlags, J9_VERIFY_VERBOSE_VERIFICATION)
+		&& J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER);
+}
+
+
+static J9Class *
+chainClassAt(J9Class *ramClass, UDATA index)
+{
+	if (0 == index) {
+		return ramClass;
+	}
+	return ramClass->superclasses[J9CLASS_DEPTH(ramClass) - index];
+}
+
+
+/*
+ * Find the layer of the shared classes cache holding romClass. The cacheDescriptorList starts with the
+ * top layer and its previous is the lowest one.
+ */
+static J9SharedClassCacheDescriptor *
+cacheLayerContaining(J9JavaVM *vm, J9ROMClass *romClass, UDATA *layer)
+{
+	J9SharedClassCacheDescriptor *lowest = vm->sharedClassConfig->cacheDescriptorList->previous;
+	J9SharedClassCacheDescriptor *cache = lowest;
+	UDATA cacheLayer = 0;
+
+	do {
+		U_8 *cacheStart = (U_8 *)cache->cacheStartAddress;
+
+		if (((U_8 *)romClass >= cacheStart) && (((U_8 *)romClass + romClass->romSize) <= (cacheStart + cache->cacheSizeBytes))) {
+			*layer = cacheLayer;
+			return cache;
+		}
+		cache = cache->previous;
+		cacheLayer += 1;
+	} while (lowest != cache);
+	return NULL;
+}
+
+
+static J9SharedClassCacheDescriptor *
+cacheLayerAt(J9JavaVM *vm, UDATA layer)
+{
+	J9SharedClassCacheDescriptor *lowest = vm->sharedClassConfig->cacheDescriptorList->previous;
+	J9SharedClassCacheDescriptor *cache = lowest;
+
+	while (0 != layer) {
+		cache = cache->previous;
+		if (lowest == cache) {
+			return NULL;
+		}
+		layer -= 1;
+	}
+	return cache;
+}
+
+
+/*
+ * Must be called with the classTableMutex held.
+ */
+static BOOLEAN
+dependencyMatches(J9BytecodeVerificationData *verifyData, J9VerifiedClassDependency *dependency)
+{
+	J9JavaVM *vm = verifyData->javaVM;
+	J9VerifiedClassChainEntry *chain = VERIFIED_DEPENDENCY_CHAIN(dependency);
+	J9Class *ramClass = vm->internalVMFunctions->hashClassTableAt(verifyData->classLoader, VERIFIED_DEPENDENCY_NAME(dependency), dependency->nameLength);
+	UDATA i = 0;
+
+	if ((NULL == ramClass) || ((J9CLASS_DEPTH(ramClass) + 1) != dependency->chainLength)) {
+		return FALSE;
+	}
+	for (i = 0; i < dependency->chainLength; i++) {
+		J9Class *chainClass = chainClassAt(ramClass, i);
+		J9SharedClassCacheDescriptor *cache = cacheLayerAt(vm, chain[i].layer);
+
+		if ((NULL == cache)
+			|| (chain[i].romClassOffset >= cache->cacheSizeBytes)
+			|| (chainClass->romClass != (J9ROMClass *)((U_8 *)cache->cacheStartAddress + chain[i].romClassOffset))
+			|| (chainClass->romClass->romSize != chain[i].romSize)
+			|| ((chainClass->classLoader == verifyData->classLoader) != (BOOLEAN)chain[i].sameLoader)
+		) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+
+/*
+ * returns TRUE if the class was verified by an earlier VM against the classes now loaded, in which
+ * case it need not be verified again. Otherwise answers FALSE and starts recording the dependencies
+ * of this verification.
+ */
+BOOLEAN
+j9bcv_checkVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass)
+{
+	J9VMThread *vmThread = verifyData->vmStruct;
+	J9JavaVM *vm = verifyData->javaVM;
+	J9SharedDataDescriptor descriptor;
+	const U_8 *found = NULL;
+	IDATA corruptOffset = -1;
+	BOOLEAN matches = FALSE;
+
+	verifyData->recordDependencies = FALSE;
+	if (!canUseVerifiedClassRecord(verifyData, clazz, romClass)) {
+		return FALSE;
+	}
+
+	descriptor.address = NULL;
+	descriptor.length = 0;
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_VERIFIED;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	found = vm->sharedClassConfig->findAttachedData(vmThread, romClass, &descriptor, &corruptOffset);
+
+	if ((NULL != found) && ((UDATA)found > J9SHR_RESOURCE_MAX_ERROR_VALUE) && (-1 == corruptOffset)
+		&& (descriptor.length >= sizeof(J9VerifiedClassRecord))
+	) {
+		J9VerifiedClassRecord *record = (J9VerifiedClassRecord *)descriptor.address;
+		BOOLEAN xfuture = J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9RuntimeFlagXfuture);
+
+		if ((record->verificationFlags == (U_32)verifyData->verificationFlags) && (record->xfuture == (U_32)xfuture)) {
+			U_8 *cursor = (U_8 *)(record + 1);
+			U_8 *end = descriptor.address + descriptor.length;
+			U_32 i = 0;
+
+			matches = TRUE;
+			omrthread_monitor_enter(vm->classTableMutex);
+			for (i = 0; i < record->dependencyCount; i++) {
+				J9VerifiedClassDependency *dependency = (J9VerifiedClassDependency *)cursor;
+
+				if (((UDATA)(end - cursor) < sizeof(J9VerifiedClassDependency))
+					|| ((UDATA)(end - cursor) < VERIFIED_DEPENDENCY_SIZE(dependency->nameLength, dependency->chainLength))
+					|| !dependencyMatches(verifyData, dependency)
+				) {
+					matches = FALSE;
+					break;
+				}
+				cursor += VERIFIED_DEPENDENCY_SIZE(dependency->nameLength, dependency->chainLength);
+			}
+			omrthread_monitor_exit(vm->classTableMutex);
+		}
+	}
+	if (NULL != descriptor.address) {
+		vm->sharedClassConfig->freeAttachedDataDescriptor(vmThread, &descriptor);
+	}
+
+	if (matches) {
+		Trc_BCV_j9bcv_checkVerifiedClassRecord_Matched(vmThread, (UDATA)J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)));
+	} else if (NULL == found) {
+		/* Only record classes which have no record, a stale record is not replaced by every VM which differs from it */
+		verifyData->recordDependencies = TRUE;
+		verifyData->dependencyRecordUsed = sizeof(J9VerifiedClassRecord);
+	}
+	return matches;
+}
+
+
+/*
+ * Add a class resolved by name by the verifier to the dependencies of the class being verified.
+ * Recording stops, and no record is stored, if the class cannot be identified in a later VM.
+ */
+void
+j9bcv_recordVerifiedClassDependency(J9BytecodeVerificationData *verifyData, U_8 *className, UDATA nameLength, J9Class *ramClass)
+{
+	PORT_ACCESS_FROM_PORT(verifyData->portLib);
+	J9JavaVM *vm = verifyData->javaVM;
+	UDATA chainLength = J9CLASS_DEPTH(ramClass) + 1;
+	UDATA entrySize = VERIFIED_DEPENDENCY_SIZE(nameLength, chainLength);
+	U_8 *cursor = NULL;
+	J9VerifiedClassDependency *dependency = NULL;
+	J9VerifiedClassChainEntry *chain = NULL;
+	UDATA i = 0;
+
+	if (!verifyData->recordDependencies) {
+		return;
+	}
+
+	/* The verifier resolves the same few classes repeatedly */
+	cursor = verifyData->dependencyRecord + sizeof(J9VerifiedClassRecord);
+	while (cursor < (verifyData->dependencyRecord + verifyData->dependencyRecordUsed)) {
+		dependency = (J9VerifiedClassDependency *)cursor;
+		if ((dependency->nameLength == nameLength) && (0 == memcmp(VERIFIED_DEPENDENCY_NAME(dependency), className, nameLength))) {
+			return;
+		}
+		cursor += VERIFIED_DEPENDENCY_SIZE(dependency->nameLength, dependency->chainLength);
+	}
+
+	if ((verifyData->dependencyRecordUsed + entrySize) > verifyData->dependencyRecordSize) {
+		UDATA newSize = OMR_MAX(VERIFIED_RECORD_INITIAL_SIZE, verifyData->dependencyRecordSize * 2);
+		U_8 *newRecord = NULL;
+
+		while (newSize < (verifyData->dependencyRecordUsed + entrySize)) {
+			newSize *= 2;
+		}
+		newRecord = j9mem_reallocate_memory(verifyData->dependencyRecord, newSize, J9MEM_CATEGORY_CLASSES);
+		if (NULL == newRecord) {
+			Trc_BCV_j9bcv_recordVerifiedClassDependency_Abandoned(verifyData->vmStruct, nameLength, className);
+			verifyData->recordDependencies = FALSE;
+			return;
+		}
+		verifyData->dependencyRecord = newRecord;
+		verifyData->dependencyRecordSize = newSize;
+	}
+
+	dependency = (J9VerifiedClassDependency *)(verifyData->dependencyRecord + verifyData->dependencyRecordUsed);
+	dependency->nameLength = (U_32)nameLength;
+	dependency->chainLength = (U_32)chainLength;
+	chain = VERIFIED_DEPENDENCY_CHAIN(dependency);
+	for (i = 0; i < chainLength; i++) {
+		J9ROMClass *chainROMClass = chainClassAt(ramClass, i)->romClass;
+		J9SharedClassCacheDescriptor *cache = NULL;
+		UDATA layer = 0;
+
+		if (j9shr_Query_IsAddressInCache(vm, chainROMClass, chainROMClass->romSize)) {
+			cache = cacheLayerContaining(vm, chainROMClass, &layer);
+		}
+		if (NULL == cache) {
+			Trc_BCV_j9bcv_recordVerifiedClassDependency_Abandoned(verifyData->vmStruct, nameLength, className);
+			verifyData->recordDependencies = FALSE;
+			return;
+		}
+		chain[i].layer = layer;
+		chain[i].romClassOffset = (UDATA)chainROMClass - (UDATA)cache->cacheStartAddress;
+		chain[i].romSize = chainROMClass->romSize;
+		chain[i].sameLoader = (chainClassAt(ramClass, i)->classLoader == verifyData->classLoader);
+	}
+	memset(VERIFIED_DEPENDENCY_NAME(dependency), 0, ROUND_UP_TO_POWEROF2(nameLength, sizeof(UDATA)));
+	memcpy(VERIFIED_DEPENDENCY_NAME(dependency), className, nameLength);
+	verifyData->dependencyRecordUsed += entrySize;
+}
+
+
+/*
+ * Store the dependencies recorded while the class verified successfully in the shared classes cache.
+ */
+void
+j9bcv_storeVerifiedClassRecord(J9BytecodeVerificationData *verifyData, J9ROMClass *romClass)
+{
+	J9JavaVM *vm = verifyData->javaVM;
+	J9VerifiedClassRecord *record = NULL;
+	J9SharedDataDescriptor descriptor;
+	U_8 *cursor = NULL;
+	U_32 dependencyCount = 0;
+	UDATA rc = 0;
+
+	if (!verifyData->recordDependencies) {
+		return;
+	}
+	verifyData->recordDependencies = FALSE;
+
+	if (NULL == verifyData->dependencyRecord) {
+		/* Nothing was resolved, the record is only the header */
+		PORT_ACCESS_FROM_PORT(verifyData->portLib);
+		verifyData->dependencyRecord = j9mem_allocate_memory(VERIFIED_RECORD_INITIAL_SIZE, J9MEM_CATEGORY_CLASSES);
+		if (NULL == verifyData->dependencyRecord) {
+			return;
+		}
+		verifyData->dependencyRecordSize = VERIFIED_RECORD_INITIAL_SIZE;
+	}
+
+	cursor = verifyData->dependencyRecord + sizeof(J9VerifiedClassRecord);
+	while (cursor < (verifyData->dependencyRecord + verifyData->dependencyRecordUsed)) {
+		J9VerifiedClassDependency *dependency = (J9VerifiedClassDependency *)cursor;
+		cursor += VERIFIED_DEPENDENCY_SIZE(dependency->nameLength, dependency->chainLength);
+		dependencyCount += 1;
+	}
+
+	record = (J9VerifiedClassRecord *)verifyData->dependencyRecord;
+	record->verificationFlags = (U_32)verifyData->verificationFlags;
+	record->xfuture = (U_32)J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9RuntimeFlagXfuture);
+	record->dependencyCount = dependencyCount;
+	record->reserved = 0;
+
+	descriptor.address = verifyData->dependencyRecord;
+	descriptor.length = verifyData->dependencyRecordUsed;
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_VERIFIED;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	rc = vm->sharedClassConfig->storeAttachedData(verifyData->vmStruct, romClass, &descriptor, FALSE);
+
+	Trc_BCV_j9bcv_storeVerifiedClassRecord_Stored(verifyData->vmStruct, (UDATA)J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)), dependencyCount, rc);
+}
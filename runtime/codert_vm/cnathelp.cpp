@@ -110,7 +110,12 @@ static VMINLINE UDATA
 convertITableOffsetToVTableOffset(J9VMThread *currentThread, J9Class *receiverClass, J9Class *interfaceClass, UDATA iTableOffset)
 {
 	UDATA vTableOffset = 0;
-	J9ITable * iTable = receiverClass->lastITable;
+	J9ITable * iTable = J9_ITABLE_DISPATCH_PROBE(receiverClass, interfaceClass);
+	if (interfaceClass == iTable->interfaceClass) {
+		goto foundITable;
+	}
+	/* An interface whose dispatch slot is taken by another may still be the last one found in the list */
+	iTable = receiverClass->lastITable;
 	if (interfaceClass == iTable->interfaceClass) {
 		goto foundITable;
 	}
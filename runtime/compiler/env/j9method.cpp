@@ -990,10 +990,12 @@ TR_ResolvedJ9Method::localName(U_32 slotNumber, U_32 bcIndex, TR_Memory *trMemor
 char *
 TR_ResolvedJ9Method::localName(U_32 slotNumber, U_32 bcIndex, I_32 &len, TR_Memory *trMemory)
    {
-   J9MethodDebugInfo *methodDebugInfo = getMethodDebugInfoForROMClass(fej9()->getJ9JITConfig()->javaVM, ramMethod());
+   J9JavaVM *javaVM = fej9()->getJ9JITConfig()->javaVM;
+   J9MethodDebugInfo *methodDebugInfo = getMethodDebugInfoForROMClass(javaVM, ramMethod());
    if (!methodDebugInfo)
       return NULL;
 
+   char *name = NULL;
    J9VariableInfoWalkState state;
    J9VariableInfoValues *values = variableInfoStartDo(methodDebugInfo, &state);
    while (NULL != values)
@@ -1002,14 +1004,17 @@ TR_ResolvedJ9Method::localName(U_32 slotNumber, U_32 bcIndex, I_32 &len, TR_Memo
       if (values->slotNumber == slotNumber
          //&& variableInfo.startVisibility <= bcIndex && bcIndex <= (variableInfo.startVisibility + variableInfo.visibilityLength)
          ){
+         // the name is a UTF8 of the ROM class, it remains valid once the debug info is released
          J9UTF8 *varName = values->name;
          len = J9UTF8_LENGTH(varName);
-         return (char*)J9UTF8_DATA(varName);
+         name = (char*)J9UTF8_DATA(varName);
+         break;
          }
       values = variableInfoNextDo(&state);
       }
 
-   return NULL;
+   releaseMethodDebugInfo(javaVM, J9_CLASS_FROM_METHOD(ramMethod())->romClass, methodDebugInfo);
+   return name;
    }
 
 char *
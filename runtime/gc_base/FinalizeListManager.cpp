@@ -285,4 +285,25 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	return NULL;
 }
 
+UDATA
+GC_FinalizeListManager::consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs)
+{
+	UDATA count = 0;
+
+	UDATA referenceCount = 0;
+
+	while ((count < maxJobs) && (NULL != consumeJob(vmThread, &jobs[count]))) {
+		if (FINALIZE_JOB_TYPE_REFERENCE == jobs[count].type) {
+			referenceCount += 1;
+		}
+		count += 1;
+	}
+	_consumedJobCount += count;
+	if (0 != referenceCount) {
+		MM_AtomicOperations::add(&_referencesInProgress, referenceCount);
+	}
+
+	return count;
+}
+
 #endif /* J9VM_GC_FINALIZATION */
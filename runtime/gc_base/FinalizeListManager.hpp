@@ -35,6 +35,7 @@
 
 #if defined(J9VM_GC_FINALIZATION)
 
+#include "AtomicOperations.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
@@ -75,6 +76,8 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    UDATA _consumedJobCount; /**< running total of jobs handed out to finalizer threads, used to derive the drain rate */
+    volatile UDATA _referencesInProgress; /**< reference jobs handed out to finalizer threads and not yet enqueued */
 protected:
 public:
     
@@ -137,6 +140,14 @@ public:
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
 	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
+	MMINLINE UDATA getConsumedJobCount() {return _consumedJobCount;}
+	MMINLINE UDATA getReferencesInProgress() {return _referencesInProgress;}
+
+	/**
+	 * Called by a finalizer thread once a reference job it consumed has been enqueued.
+	 * May be called without holding this class' _mutex.
+	 */
+	MMINLINE void referenceProcessed() {MM_AtomicOperations::subtract(&_referencesInProgress, 1);}
 
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -331,6 +342,21 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop up to maxJobs jobs to process in one batch, so finalizer threads
+	 * take the list mutex once per batch rather than once per job
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * Popped reference jobs are counted as in progress until referenceProcessed() is called for each of them.
+	 *
+	 * @param jobs[out] array of at least maxJobs entries to fill
+	 * @param maxJobs[in] the largest number of jobs to pop
+	 *
+	 * @return the number of jobs popped, 0 if the lists are empty
+	 */
+	UDATA consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs);
+
 
 	/**
 	 * Create a FinalizeListManager object
@@ -346,6 +372,8 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_consumedJobCount(0)
+	    ,_referencesInProgress(0)
 	{
 		_typeId = __FUNCTION__;
 	};
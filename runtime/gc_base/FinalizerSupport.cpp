@@ -177,10 +177,63 @@ struct finalizeSlaveData {
 	IDATA wakeUp;
 };
 
+/**
+ * A job consumed from the finalize lists. Objects are held by JNI local refs, since once off the
+ * lists nothing else keeps them alive across the GCs that may run while earlier jobs of the batch
+ * are being processed.
+ */
+struct finalizeBatchEntry {
+	GC_FinalizeJobType type;
+	union {
+		jobject ref;
+		J9ClassLoader *classLoader;
+	};
+};
+
+struct finalizeHelperData;
+
+/**
+ * Helper slaves drain the finalize lists alongside the primary slave when -Xgc:finalizeSlaveCount
+ * is greater than 1. They only ever consume jobs as in FINALIZE_SLAVE_MODE_NORMAL, but keep draining
+ * while the primary slave runs a forced or class loader unload cycle. A runFinalization() request is
+ * therefore only reported complete once the helpers are idle as well.
+ * The master frees the pool at shutdown once every helper has exited. A helper abandoned inside
+ * System.exit() never exits, and its pool is left for process exit to reclaim.
+ *
+ * Lock order:
+ * 	finalizeMasterMonitor before the pool monitor
+ * 	processReferenceMonitor before the finalize list lock
+ * 	finalize list lock before classLoaderBlocksMutex
+ * The slave and pool monitors are never held while a job is processed, and no finalizer thread
+ * enters processReferenceMonitor while holding the finalize list lock.
+ */
+struct finalizeHelperPool {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	struct finalizeHelperData *helpers; /* helpers which have not exited yet */
+	UDATA activeCount; /* helpers the master waits for at shutdown */
+	UDATA busyCount; /* helpers currently draining the lists */
+	UDATA workRequests; /* bumped by the master to wake the helpers up */
+	bool shutdown;
+};
+
+struct finalizeHelperData {
+	struct finalizeHelperPool *pool;
+	J9VMThread *vmThread;
+	struct finalizeHelperData *next;
+	bool started;
+	bool abandoned;
+};
+
 static int J9THREAD_PROC FinalizeSlaveThread(void *arg);
 IDATA FinalizeMasterRunFinalization(J9JavaVM * vm, omrthread_t * indirectSlaveThreadHandle, struct finalizeSlaveData **indirectSlaveData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMasterThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeSlaveThread(void *entryArg);
+static int  J9THREAD_PROC gpProtectedFinalizeHelperThread(void *entryArg);
+static struct finalizeHelperPool *startFinalizeHelpers(J9JavaVM *vm, UDATA helperCount);
+static void stopFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *pool);
+static bool waitForFinalizeHelpersIdle(J9JavaVM *vm, struct finalizeHelperPool *pool, IDATA timeout);
+static void abandonFinalizeHelper(J9VMThread *vmThread);
 
 static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 {
@@ -188,6 +241,8 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 	omrthread_t slaveThreadHandle;
 	int doneRunFinalizersOnExit, noCycleWait;
 	struct finalizeSlaveData *slaveData = NULL;
+	struct finalizeHelperPool *helperPool = NULL;
+	bool helperStartAttempted = false;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA slaveMode, savedFinalizeMasterFlags;
@@ -269,6 +324,21 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 				slaveMode = FINALIZE_SLAVE_MODE_NORMAL;
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
+		/* Let the helper slaves share any backlog larger than one batch of the primary slave */
+		if ((FINALIZE_SLAVE_MODE_NORMAL == slaveMode) && (1 < extensions->finalizeSlaveCount) && ((UDATA)finalizableListUsed > extensions->finalizeBatchSize)) {
+			if (!helperStartAttempted) {
+				helperStartAttempted = true;
+				helperPool = startFinalizeHelpers(vm, extensions->finalizeSlaveCount - 1);
+				extensions->finalizeHelperPool = helperPool;
+			}
+			if (NULL != helperPool) {
+				omrthread_monitor_enter(helperPool->monitor);
+				helperPool->workRequests += 1;
+				omrthread_monitor_notify_all(helperPool->monitor);
+				omrthread_monitor_exit(helperPool->monitor);
+			}
+		}
+
 		savedFinalizeMasterFlags = vm->finalizeMasterFlags;
 
 		IDATA result = FinalizeMasterRunFinalization(vm, &slaveThreadHandle, &slaveData, finalizeCycleLimit, slaveMode);
@@ -288,7 +358,12 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 				if(!(savedFinalizeMasterFlags & J9_FINALIZE_FLAGS_FORCE_CLASS_LOADER_UNLOAD)) {
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 					currentWaitTime = 0;
-					if(savedFinalizeMasterFlags & J9_FINALIZE_FLAGS_RUN_FINALIZATION) {
+					/* Jobs consumed by the helpers are off the lists but may not have been processed yet.
+					 * If the helpers are still busy, the request stays set and is checked again next cycle.
+					 */
+					if((savedFinalizeMasterFlags & J9_FINALIZE_FLAGS_RUN_FINALIZATION)
+						&& ((NULL == helperPool) || waitForFinalizeHelpersIdle(vm, helperPool, finalizeCycleLimit))
+					) {
 						vm->finalizeMasterFlags &= ~J9_FINALIZE_FLAGS_RUN_FINALIZATION;
 						omrthread_monitor_enter(vm->finalizeRunFinalizationMutex);
 						omrthread_monitor_notify_all(vm->finalizeRunFinalizationMutex);
@@ -306,6 +381,12 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 		omrthread_monitor_exit(slaveData->monitor);
 	} while(!(vm->finalizeMasterFlags & J9_FINALIZE_FLAGS_SHUTDOWN));
 
+	/* Helpers finish the batch in hand; anything left on the lists goes to the primary slave below */
+	if(NULL != helperPool) {
+		stopFinalizeHelpers(vm, helperPool);
+		helperPool = NULL;
+	}
+
 	/* Check if finalizers should be run on exit */
 	if(vm->finalizeMasterFlags & J9_FINALIZE_FLAGS_RUN_FINALIZERS_ON_EXIT) {
 		doneRunFinalizersOnExit = 0;
@@ -376,7 +457,7 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 }
 
 static void
-process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
+process_finalizable(J9VMThread *vmThread, jobject localRef, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -384,8 +465,6 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, object);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if((NULL != j9VMInternalsClass) && (NULL != runFinalizeMID)) {
@@ -405,7 +484,7 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 }
 
 static void
-process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
+process_reference(J9VMThread *vmThread, jobject localRef, jmethodID refMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -413,8 +492,6 @@ process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, reference);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if (refMID) {
@@ -453,49 +530,99 @@ process_classloader(J9VMThread *vmThread, J9ClassLoader *classLoader)
 }
 
 static void
-process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
+process(J9VMThread *vmThread, const struct finalizeBatchEntry *entry, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
 {
-	if (FINALIZE_JOB_TYPE_OBJECT == (finalizeJob->type & FINALIZE_JOB_TYPE_OBJECT)) {
-		process_finalizable(vmThread, finalizeJob->object, j9VMInternalsClass, runFinalizeMID);
-	} else if (FINALIZE_JOB_TYPE_REFERENCE == (finalizeJob->type & FINALIZE_JOB_TYPE_REFERENCE)) {
-		process_reference(vmThread, finalizeJob->reference, referenceEnqueueImplMID);
-	} else if (FINALIZE_JOB_TYPE_CLASSLOADER == (finalizeJob->type & FINALIZE_JOB_TYPE_CLASSLOADER)) {
-		process_classloader(vmThread, finalizeJob->classLoader);
+	if (FINALIZE_JOB_TYPE_OBJECT == (entry->type & FINALIZE_JOB_TYPE_OBJECT)) {
+		process_finalizable(vmThread, entry->ref, j9VMInternalsClass, runFinalizeMID);
+	} else if (FINALIZE_JOB_TYPE_REFERENCE == (entry->type & FINALIZE_JOB_TYPE_REFERENCE)) {
+		process_reference(vmThread, entry->ref, referenceEnqueueImplMID);
+	} else if (FINALIZE_JOB_TYPE_CLASSLOADER == (entry->type & FINALIZE_JOB_TYPE_CLASSLOADER)) {
+		process_classloader(vmThread, entry->classLoader);
 	} else {
 		Assert_MM_unreachable();
 	}
 }
 
 /**
- * Slave thread consumes jobs from Finalize List Manager and process them
+ * Consume up to batchSize jobs from the Finalize List Manager under a single acquisition of its lock
+ * and pin their objects with local refs. The caller must hold VM access.
+ * @return the number of entries filled in, 0 if there is no work left
  */
-static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
+static UDATA
+consumeFinalizeBatch(J9VMThread *vmThread, GC_FinalizeListManager *finalizeListManager, struct finalizeBatchEntry *batch, UDATA batchSize, bool forced)
 {
-	struct finalizeSlaveData *slaveData = (struct finalizeSlaveData *)arg;
-	J9VMThread *env;
-	const GC_FinalizeJob *finalizeJob;
-	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
-	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
-	J9InternalVMFunctions* fns;
-	omrthread_monitor_t monitor;
-	GC_FinalizeListManager *finalizeListManager;
-	J9JavaVM *vm = (J9JavaVM *)(slaveData->vm);
-	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
-	MM_Forge *forge = extensions->getForge();
+	J9InternalVMFunctions *fns = vmThread->javaVM->internalVMFunctions;
+	GC_FinalizeJob jobs[J9_FINALIZE_BATCH_SIZE_MAX];
 
-	fns = vm->internalVMFunctions;
-	monitor = slaveData->monitor;
+	Assert_MM_true(batchSize <= J9_FINALIZE_BATCH_SIZE_MAX);
 
-	finalizeListManager = extensions->finalizeListManager;
+	finalizeListManager->lock();
+
+	UDATA count = finalizeListManager->consumeJobs(vmThread, jobs, batchSize);
+	if ((0 == count) && forced) {
+		finalizeForcedUnfinalizedToFinalizable(vmThread);
+		count = finalizeListManager->consumeJobs(vmThread, jobs, batchSize);
+	}
+
+	finalizeListManager->unlock();
+
+	for (UDATA i = 0; i < count; i++) {
+		batch[i].type = jobs[i].type;
+		if (FINALIZE_JOB_TYPE_CLASSLOADER == jobs[i].type) {
+			batch[i].classLoader = jobs[i].classLoader;
+		} else if (FINALIZE_JOB_TYPE_REFERENCE == jobs[i].type) {
+			batch[i].ref = fns->j9jni_createLocalRef((JNIEnv *)vmThread, jobs[i].reference);
+		} else {
+			batch[i].ref = fns->j9jni_createLocalRef((JNIEnv *)vmThread, jobs[i].object);
+		}
+	}
+
+	return count;
+}
+
+static void
+notifyReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager, const struct finalizeBatchEntry *entry)
+{
+	if (FINALIZE_JOB_TYPE_REFERENCE == (entry->type & FINALIZE_JOB_TYPE_REFERENCE)) {
+		finalizeListManager->referenceProcessed();
+	}
 
-	if (JNI_OK != vm->internalVMFunctions->attachSystemDaemonThread(vm, &env, "Finalizer thread")) {
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		/* References consumed in the batches of this or other finalizer threads are off the lists, but are
+		 * not enqueued until they have been processed. Both counts are read under the list lock, which is
+		 * held while references move from one to the other.
+		 */
+		finalizeListManager->lock();
+		bool referencesPending = (0 != finalizeListManager->getReferenceCount()) || (0 != finalizeListManager->getReferencesInProgress());
+		finalizeListManager->unlock();
+		if (!referencesPending) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/**
+ * Attach the current thread as a finalizer thread.
+ * @return the attached thread, or NULL if the attach failed
+ */
+static J9VMThread *
+attachFinalizeSlaveThread(J9JavaVM *vm)
+{
+	J9InternalVMFunctions* fns = vm->internalVMFunctions;
+	J9VMThread *env = NULL;
+
+	if (JNI_OK != fns->attachSystemDaemonThread(vm, &env, "Finalizer thread")) {
 		/* Failed to attach the thread - very bad, most likely out of memory */
-		slaveData->vmThread = (J9VMThread *)NULL;
-		omrthread_monitor_enter(monitor);
-		omrthread_monitor_notify_all(monitor);
-		omrthread_monitor_exit(monitor);
-		return 0;
+		return NULL;
 	}
 
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
@@ -512,6 +639,16 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
+	return env;
+}
+
+static void
+lookupFinalizationMethods(J9VMThread *env, jclass *j9VMInternalsClassOut, jmethodID *runFinalizeMIDOut, jmethodID *referenceEnqueueImplMIDOut)
+{
+	J9JavaVM *vm = env->javaVM;
+	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+
 	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
 		/* Only look up finalization methods if the class library supports them */
 		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
@@ -532,7 +669,61 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 		if (!referenceEnqueueImplMID) {
 			((JNIEnv *)env)->ExceptionClear();
 		}
-	}		
+	}
+
+	*j9VMInternalsClassOut = j9VMInternalsClass;
+	*runFinalizeMIDOut = runFinalizeMID;
+	*referenceEnqueueImplMIDOut = referenceEnqueueImplMID;
+}
+
+static void
+detachFinalizeSlaveThread(J9JavaVM *vm, J9VMThread *env, jclass j9VMInternalsClass)
+{
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
+	if( vm->javaOffloadSwitchOffNoEnvWithReasonFunc != NULL ) {
+		(*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, omrthread_self(), J9_JNI_OFFLOAD_SWITCH_FINALIZE_SLAVE_THREAD);
+	}
+#endif
+}
+
+/**
+ * Slave thread consumes jobs from Finalize List Manager and process them
+ */
+static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
+{
+	struct finalizeSlaveData *slaveData = (struct finalizeSlaveData *)arg;
+	J9VMThread *env;
+	struct finalizeBatchEntry batch[J9_FINALIZE_BATCH_SIZE_MAX];
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	J9InternalVMFunctions* fns;
+	omrthread_monitor_t monitor;
+	GC_FinalizeListManager *finalizeListManager;
+	J9JavaVM *vm = (J9JavaVM *)(slaveData->vm);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+
+	fns = vm->internalVMFunctions;
+	monitor = slaveData->monitor;
+
+	finalizeListManager = extensions->finalizeListManager;
+
+	env = attachFinalizeSlaveThread(vm);
+	if (NULL == env) {
+		slaveData->vmThread = (J9VMThread *)NULL;
+		omrthread_monitor_enter(monitor);
+		omrthread_monitor_notify_all(monitor);
+		omrthread_monitor_exit(monitor);
+		return 0;
+	}
+
+	lookupFinalizationMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
 	slaveData->vmThread = env;
 
 	/* Notify that the slave has come on line (We should check the result from above) */
@@ -565,34 +756,24 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 		}
 
 		do {
+			UDATA batchCount = 0;
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 			if(slaveData->mode == FINALIZE_SLAVE_MODE_CL_UNLOAD) {
 				
-				if (NULL == (localJob.classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
+				if (NULL == (batch[0].classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
 					break;
 				} else {
-					localJob.type = FINALIZE_JOB_TYPE_CLASSLOADER;
-					finalizeJob = &localJob;
+					batch[0].type = FINALIZE_JOB_TYPE_CLASSLOADER;
+					batchCount = 1;
 				}
 
 			} else {
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
-
-				finalizeListManager->lock();
-				
-				finalizeJob = finalizeListManager->consumeJob(env, &localJob);
-				if(finalizeJob == NULL) {
-					if(slaveData->mode == FINALIZE_SLAVE_MODE_FORCED) {
-						finalizeForcedUnfinalizedToFinalizable(env);
-						finalizeJob = finalizeListManager->consumeJob(env, &localJob);
-					}
-				}
-
-				finalizeListManager->unlock();
+				batchCount = consumeFinalizeBatch(env, finalizeListManager, batch, extensions->finalizeBatchSize, FINALIZE_SLAVE_MODE_FORCED == slaveData->mode);
 				
-				if(NULL != finalizeJob) {
+				if(0 != batchCount) {
 					slaveData->noWorkDone = 0;
 				} else {
 					slaveData->noWorkDone = 1;
@@ -603,22 +784,11 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 			}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
-			/* processing will release/acquire VM access */
-			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
-
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
+			/* The whole batch is processed even if we get abandoned part way through, since its jobs are no longer on the lists */
+			for (UDATA i = 0; i < batchCount; i++) {
+				/* processing will release/acquire VM access */
+				process(env, &batch[i], j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+				notifyReferenceProcessingProgress(vm, finalizeListManager, &batch[i]);
 			}
 
 			fns->jniResetStackReferences((JNIEnv *)env);
@@ -638,17 +808,7 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 		omrthread_monitor_notify_all(monitor);
 	} while(slaveData->die == FINALIZE_SLAVE_STAY_ALIVE);
 	
-	if (j9VMInternalsClass) {
-		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
-	}
-
-	((JavaVM *)vm)->DetachCurrentThread();
-
-#if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
-	if( vm->javaOffloadSwitchOffNoEnvWithReasonFunc != NULL ) {
-		(*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, omrthread_self(), J9_JNI_OFFLOAD_SWITCH_FINALIZE_SLAVE_THREAD);
-	}
-#endif
+	detachFinalizeSlaveThread(vm, env, j9VMInternalsClass);
 
 	switch(slaveData->die) {
 		case FINALIZE_SLAVE_SHOULD_ABANDON:
@@ -822,6 +982,289 @@ gpProtectedFinalizeSlaveThread(void *entryArg)
 	return 0;
 }
 
+/**
+ * Helper slave thread drains batches from the Finalize List Manager each time the master reports a backlog
+ */
+static int J9THREAD_PROC FinalizeHelperThread(void *arg)
+{
+	struct finalizeHelperData *helperData = (struct finalizeHelperData *)arg;
+	struct finalizeHelperPool *pool = helperData->pool;
+	J9JavaVM *vm = pool->vm;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+	J9InternalVMFunctions* fns = vm->internalVMFunctions;
+	struct finalizeBatchEntry batch[J9_FINALIZE_BATCH_SIZE_MAX];
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	UDATA workRequestsSeen = 0;
+
+	J9VMThread *env = attachFinalizeSlaveThread(vm);
+	if (NULL != env) {
+		lookupFinalizationMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+	}
+
+	omrthread_monitor_enter(pool->monitor);
+	helperData->vmThread = env;
+	helperData->started = true;
+	omrthread_monitor_notify_all(pool->monitor);
+	if (NULL == env) {
+		/* The master frees helperData once it sees the failed start */
+		omrthread_monitor_exit(pool->monitor);
+		return 0;
+	}
+
+	while (!pool->shutdown && !helperData->abandoned) {
+		if (workRequestsSeen == pool->workRequests) {
+			omrthread_monitor_wait(pool->monitor);
+			continue;
+		}
+		workRequestsSeen = pool->workRequests;
+		pool->busyCount += 1;
+		omrthread_monitor_exit(pool->monitor);
+
+		fns->internalEnterVMFromJNI(env);
+
+		UDATA batchCount = 0;
+		while (0 != (batchCount = consumeFinalizeBatch(env, finalizeListManager, batch, extensions->finalizeBatchSize, false))) {
+			for (UDATA i = 0; i < batchCount; i++) {
+				/* processing will release/acquire VM access */
+				process(env, &batch[i], j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+				notifyReferenceProcessingProgress(vm, finalizeListManager, &batch[i]);
+			}
+
+			fns->jniResetStackReferences((JNIEnv *)env);
+
+			if (pool->shutdown) {
+				break;
+			}
+		}
+
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(pool->monitor);
+		pool->busyCount -= 1;
+		if (0 == pool->busyCount) {
+			omrthread_monitor_notify_all(pool->monitor);
+		}
+	}
+
+	detachFinalizeSlaveThread(vm, env, j9VMInternalsClass);
+
+	struct finalizeHelperData **link = &pool->helpers;
+	while (helperData != *link) {
+		link = &(*link)->next;
+	}
+	*link = helperData->next;
+	if (!helperData->abandoned) {
+		pool->activeCount -= 1;
+	}
+	forge->free(helperData);
+
+	omrthread_monitor_notify_all(pool->monitor);
+	omrthread_exit(pool->monitor);		/* exit the monitor, and terminate the thread */
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+
+	return 0;
+}
+
+static UDATA
+FinalizeHelperThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeHelperThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeHelperThread(void *entryArg)
+{
+	struct finalizeHelperData *helperData = (struct finalizeHelperData *) entryArg;
+	J9JavaVM *vm = helperData->pool->vm;
+	PORT_ACCESS_FROM_PORT(vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeHelperThreadGlue, helperData,
+		vm->internalVMFunctions->structuredSignalHandlerVM, vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+/*
+ * Start up to helperCount helper slaves.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ *
+ * @return the helper pool, or NULL if no helper could be started
+ */
+static struct finalizeHelperPool *
+startFinalizeHelpers(J9JavaVM *vm, UDATA helperCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	struct finalizeHelperPool *pool = NULL;
+
+	pool = (struct finalizeHelperPool *) forge->allocate(sizeof(struct finalizeHelperPool), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL == pool) {
+		return NULL;
+	}
+	pool->vm = vm;
+	pool->helpers = NULL;
+	pool->activeCount = 0;
+	pool->busyCount = 0;
+	pool->workRequests = 0;
+	pool->shutdown = false;
+
+	if (0 != omrthread_monitor_init(&(pool->monitor), 0)) {
+		forge->free(pool);
+		return NULL;
+	}
+
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+	omrthread_monitor_enter(pool->monitor);
+
+	for (UDATA i = 0; i < helperCount; i++) {
+		struct finalizeHelperData *helperData = (struct finalizeHelperData *) forge->allocate(sizeof(struct finalizeHelperData), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+		if (NULL == helperData) {
+			break;
+		}
+		helperData->pool = pool;
+		helperData->vmThread = NULL;
+		helperData->next = NULL;
+		helperData->started = false;
+		helperData->abandoned = false;
+
+		omrthread_t helperThreadHandle = NULL;
+		IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+							&helperThreadHandle,
+							vm->defaultOSStackSize,
+							extensions->finalizeSlavePriority,
+							0,
+							&gpProtectedFinalizeHelperThread,
+							helperData,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+
+		if (0 == result) {
+			while (!helperData->started) {
+				omrthread_monitor_wait(pool->monitor);
+			}
+		}
+		if ((0 != result) || (NULL == helperData->vmThread)) {
+			/* Carry on with the helpers we have */
+			forge->free(helperData);
+			break;
+		}
+
+		helperData->next = pool->helpers;
+		pool->helpers = helperData;
+		pool->activeCount += 1;
+	}
+
+	bool noHelpers = (NULL == pool->helpers);
+	omrthread_monitor_exit(pool->monitor);
+
+	if (noHelpers) {
+		omrthread_monitor_destroy(pool->monitor);
+		forge->free(pool);
+		pool = NULL;
+	}
+
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+
+	return pool;
+}
+
+/*
+ * Stop the helper slaves, waiting for all but the ones abandoned in System.exit() to detach.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ */
+static void
+stopFinalizeHelpers(J9JavaVM *vm, struct finalizeHelperPool *pool)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+
+	omrthread_monitor_enter(pool->monitor);
+	pool->shutdown = true;
+	omrthread_monitor_notify_all(pool->monitor);
+	while (0 != pool->activeCount) {
+		omrthread_monitor_wait(pool->monitor);
+	}
+	bool helpersExited = (NULL == pool->helpers);
+	omrthread_monitor_exit(pool->monitor);
+
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+
+	/* An abandoned helper still references the pool, so it is left for process exit to reclaim */
+	if (helpersExited) {
+		extensions->finalizeHelperPool = NULL;
+		omrthread_monitor_destroy(pool->monitor);
+		extensions->getForge()->free(pool);
+	}
+}
+
+/*
+ * Wait up to timeout milliseconds for the helper slaves to finish the batches they have consumed.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ * Postconditions:
+ * 	holds finalizeMasterMonitor
+ *
+ * @return true if no helper is draining the lists
+ */
+static bool
+waitForFinalizeHelpersIdle(J9JavaVM *vm, struct finalizeHelperPool *pool, IDATA timeout)
+{
+	omrthread_monitor_exit(vm->finalizeMasterMonitor);
+
+	omrthread_monitor_enter(pool->monitor);
+	if (0 != pool->busyCount) {
+		omrthread_monitor_wait_timed(pool->monitor, timeout, 0);
+	}
+	bool idle = (0 == pool->busyCount);
+	omrthread_monitor_exit(pool->monitor);
+
+	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+
+	return idle;
+}
+
+/*
+ * Keep the master from waiting at shutdown for the current thread if it is a helper slave,
+ * since it is about to block until finalization has shut down.
+ *
+ * Preconditions:
+ * 	holds finalizeMasterMonitor
+ */
+static void
+abandonFinalizeHelper(J9VMThread *vmThread)
+{
+	struct finalizeHelperPool *pool = (struct finalizeHelperPool *)MM_GCExtensions::getExtensions(vmThread->javaVM)->finalizeHelperPool;
+
+	if ((NULL != pool) && J9_ARE_ANY_BITS_SET(vmThread->privateFlags, J9_PRIVATE_FLAGS_FINALIZE_SLAVE)) {
+		omrthread_monitor_enter(pool->monitor);
+		for (struct finalizeHelperData *helperData = pool->helpers; NULL != helperData; helperData = helperData->next) {
+			if ((vmThread == helperData->vmThread) && !helperData->abandoned) {
+				helperData->abandoned = true;
+				pool->activeCount -= 1;
+				omrthread_monitor_notify_all(pool->monitor);
+				break;
+			}
+		}
+		omrthread_monitor_exit(pool->monitor);
+	}
+}
+
 void
 j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread)
 {
@@ -834,6 +1277,8 @@ j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread)
 
 	/* Set the run finalizers on exit flag and initiate finalizer shutdown. */
 	omrthread_monitor_enter(vm->finalizeMasterMonitor);
+	/* The current thread may be a helper slave, which the master must not wait for */
+	abandonFinalizeHelper(vmThread);
 	vm->finalizeMasterFlags |= J9_FINALIZE_FLAGS_RUN_FINALIZERS_ON_EXIT;
 	if (!J9_ARE_ALL_BITS_SET(vm->finalizeMasterFlags, J9_FINALIZE_FLAGS_SHUTDOWN)) {
 		vm->finalizeMasterFlags |= J9_FINALIZE_FLAGS_SHUTDOWN;
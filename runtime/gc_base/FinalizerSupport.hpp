@@ -42,4 +42,7 @@
 #define J9_FINALIZE_JOB_TYPE_FREE_CLASS_LOADER 2
 #define J9_FINALIZE_JOB_TYPE_REF_ENQUEUE 3
 
+#define J9_FINALIZE_SLAVE_COUNT_MAX 64
+#define J9_FINALIZE_BATCH_SIZE_MAX 64
+
 #endif /* FINALIZERSUPPORT_HPP */
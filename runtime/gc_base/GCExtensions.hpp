@@ -142,6 +142,9 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA finalizeMasterPriority; /**< cmd line option to set finalize master thread priority */
 	UDATA finalizeSlavePriority; /**< cmd line option to set finalize slave thread priority */
+	UDATA finalizeSlaveCount; /**< cmd line option to set the number of finalize slave threads draining the finalize lists (the first one is the master's primary slave) */
+	UDATA finalizeBatchSize; /**< cmd line option to set the number of jobs a finalize slave consumes per acquisition of the finalize list lock */
+	void *finalizeHelperPool; /**< helper finalize slaves started by the finalize master thread, NULL if there are none */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -184,6 +187,15 @@ public:
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
 #endif
 
+#if defined(J9VM_GC_REALTIME)
+	bool metronomeAlarmUseTimerFD; /**< Use a timerfd (CLOCK_MONOTONIC) alarm to drive Metronome beats where the OS supports it */
+	UDATA metronomeAlarmFIFOPriority; /**< If non-zero, the SCHED_FIFO priority given to the Metronome alarm thread (timerfd alarm only) */
+#endif /* defined(J9VM_GC_REALTIME) */
+#if defined(J9VM_GC_VLHGC)
+	bool copyForwardScanOrderingForced; /**< true if the scan ordering was explicitly specified on the command line and must not be replaced by the copy-forward default */
+	UDATA copyForwardPrefetchDistance; /**< Number of objects (or array elements) ahead of the copy-forward scan pointer whose referents are prefetched (0, the default, disables prefetching) */
+#endif /* defined(J9VM_GC_VLHGC) */
+
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
@@ -300,6 +312,9 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMasterPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeSlavePriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeSlaveCount(1)
+		, finalizeBatchSize(16)
+		, finalizeHelperPool(NULL)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -315,6 +330,14 @@ public:
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
 #endif
+#if defined(J9VM_GC_REALTIME)
+		, metronomeAlarmUseTimerFD(true)
+		, metronomeAlarmFIFOPriority(0)
+#endif /* defined(J9VM_GC_REALTIME) */
+#if defined(J9VM_GC_VLHGC)
+		, copyForwardScanOrderingForced(false)
+		, copyForwardPrefetchDistance(0)
+#endif /* defined(J9VM_GC_VLHGC) */
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 	{
@@ -120,6 +120,22 @@
 #define J9GC_CLASS_SHAPE(ramClass)		(J9CLASS_SHAPE(ramClass))
 #define J9GC_CLASS_IS_ARRAY(ramClass)	(J9CLASS_IS_ARRAY(ramClass))
 
+/**
+ * @ingroup GC_Base
+ * Hint that the cache line containing address will be read soon. The hint never faults, so
+ * address may be NULL or stale. Expands to nothing on compilers without a prefetch intrinsic.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define J9GC_PREFETCH_FOR_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#elif defined(AIXPPC) && (defined(__IBMC__) || defined(__IBMCPP__))
+#define J9GC_PREFETCH_FOR_READ(address) __dcbt((void *)(address))
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#define J9GC_PREFETCH_FOR_READ(address) _mm_prefetch((const char *)(address), _MM_HINT_T0)
+#else
+#define J9GC_PREFETCH_FOR_READ(address)
+#endif
+
 #if defined (OMR_GC_COMPRESSED_POINTERS)
 
 extern "C" mm_j9object_t j9gc_objaccess_pointerFromToken(J9VMThread *vmThread, fj9object_t token);
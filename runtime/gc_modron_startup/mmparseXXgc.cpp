@@ -168,6 +168,21 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->nonDeterministicSweep = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "metronomeAlarmTimerFD")) {
+			extensions->metronomeAlarmUseTimerFD = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "noMetronomeAlarmTimerFD")) {
+			extensions->metronomeAlarmUseTimerFD = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "metronomeAlarmFIFOPriority=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->metronomeAlarmFIFOPriority), "metronomeAlarmFIFOPriority=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if(try_scan(&scan_start, "fixHeapForWalk")) {
 			extensions->fixHeapForWalk = true;
 			continue;
@@ -366,6 +381,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokTgcEnableRememberedSetDuplicateDetection = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "copyForwardPrefetchDistance=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->copyForwardPrefetchDistance, "copyForwardPrefetchDistance=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokPGCOnlyCopyForward")) {
 			extensions->tarokPGCShouldMarkCompact = false;
 			continue;
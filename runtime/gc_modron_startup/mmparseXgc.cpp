@@ -40,6 +40,7 @@ static const char *versionString = "Modron $Name: not supported by cvs2svn $";
 
 #include "mmparse.h"
 
+#include "FinalizerSupport.hpp"
 #include "GCExtensions.hpp"
 #include "Math.hpp"
 
@@ -1115,11 +1116,17 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 	
 	if(try_scan(scan_start, "hierarchicalScanOrdering")) {
 		extensions->scavengerScanOrdering = MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+#if defined(J9VM_GC_VLHGC)
+		extensions->copyForwardScanOrderingForced = true;
+#endif /* defined(J9VM_GC_VLHGC) */
 		goto _exit;
 	}
 	
 	if(try_scan(scan_start, "breadthFirstScanOrdering")) {
 		extensions->scavengerScanOrdering = MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+#if defined(J9VM_GC_VLHGC)
+		extensions->copyForwardScanOrderingForced = true;
+#endif /* defined(J9VM_GC_VLHGC) */
 		goto _exit;
 	}
 		
@@ -1289,6 +1296,30 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeSlaveCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeSlaveCount, "finalizeSlaveCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->finalizeSlaveCount < 1) || (extensions->finalizeSlaveCount > J9_FINALIZE_SLAVE_COUNT_MAX)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeSlaveCount", (UDATA)1, (UDATA)J9_FINALIZE_SLAVE_COUNT_MAX);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "finalizeBatchSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeBatchSize, "finalizeBatchSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((extensions->finalizeBatchSize < 1) || (extensions->finalizeBatchSize > J9_FINALIZE_BATCH_SIZE_MAX)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeBatchSize", (UDATA)1, (UDATA)J9_FINALIZE_BATCH_SIZE_MAX);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -43,6 +43,8 @@
 
 #define INTER_YIELD_WARNING_THRESHOLD_NS 80000
 #define UTILIZATION_WINDOW_SIZE 100
+/* Bucket 0 counts beats woken less than 1us late, bucket i counts [2^(i-1), 2^i) us late, the last bucket is open ended */
+#define BEAT_JITTER_HISTOGRAM_SIZE 16
 
 #define ROOT_GRANULARITY 100
 
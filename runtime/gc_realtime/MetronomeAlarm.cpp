@@ -21,9 +21,11 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
 #include "MetronomeAlarmThread.hpp"
 #include "OSInterface.hpp"
 #include "Scheduler.hpp"
+#include "UtilizationTracker.hpp"
 
 #include "MetronomeAlarm.hpp"
 
@@ -48,8 +50,10 @@
 #endif /* #if defined(LINUX) */
 #if defined(LINUX) && !defined(J9ZTPF)
 #include <linux/rtc.h>
+#include <pthread.h>
 #include <sys/syscall.h>
 #include <sys/signal.h>
+#include <sys/timerfd.h>
 #elif defined(J9ZTPF)
 #include <signal.h>
 #endif /* defined(LINUX) && !defined(J9ZTPF) */
@@ -66,6 +70,18 @@ MM_HRTAlarm::newInstance(MM_EnvironmentBase *env)
 	return alarm;
 }
 
+MM_TimerFDAlarm *
+MM_TimerFDAlarm::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TimerFDAlarm * alarm;
+	
+	alarm = (MM_TimerFDAlarm *)env->getForge()->allocate(sizeof(MM_TimerFDAlarm), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (alarm) {
+		new(alarm) MM_TimerFDAlarm();
+	}
+	return alarm;
+}
+
 MM_RTCAlarm *
 MM_RTCAlarm::newInstance(MM_EnvironmentBase *env)
 {
@@ -98,7 +114,9 @@ MM_Alarm::factory(MM_EnvironmentBase *env, MM_OSInterface* osInterface)
 {
 	MM_Alarm *alarm = NULL;
 	
-	if (osInterface->hiresTimerAvailable()) {
+	if (MM_GCExtensions::getExtensions(env)->metronomeAlarmUseTimerFD && osInterface->timerFDAvailable()) {
+		alarm = MM_TimerFDAlarm::newInstance(env);
+	} else if (osInterface->hiresTimerAvailable()) {
 		alarm = MM_HRTAlarm::newInstance(env);
 	} else if (osInterface->itTimerAvailable()) {
 		alarm = MM_ITAlarm::newInstance(env);
@@ -120,6 +138,52 @@ MM_HRTAlarm::initialize(MM_EnvironmentBase *env, MM_MetronomeAlarmThread* alarmT
 	return alarmThread->startThread(env);
 }
 
+/**
+ * initialize
+ * Arm a periodic timerfd for use by Metronome. The first expiry is one period from now and
+ * is given as an absolute time so that the expected time of every later expiry is known.
+ * @return true if the timer was successfully armed and the alarm thread started, false
+ *  otherwise
+ */
+bool
+MM_TimerFDAlarm::initialize(MM_EnvironmentBase *env, MM_MetronomeAlarmThread* alarmThread)
+{
+	_extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	_utilTracker = alarmThread->getScheduler()->_utilTracker;
+#if defined(LINUX) && !defined(J9ZTPF)
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	struct timespec now;
+	struct itimerspec spec;
+
+	_timerFD = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (-1 == _timerFD) {
+		if (_extensions->verbose >= 2) {
+			omrtty_printf("Unable to create timerfd\n");
+		}
+		return false;
+	}
+
+	_periodNanos = (U_64)_extensions->hrtPeriodMicro * 1000;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	_nextExpiryNanos = ((U_64)now.tv_sec * 1000000000) + (U_64)now.tv_nsec + _periodNanos;
+
+	spec.it_interval.tv_sec = (time_t)(_periodNanos / 1000000000);
+	spec.it_interval.tv_nsec = (long)(_periodNanos % 1000000000);
+	spec.it_value.tv_sec = (time_t)(_nextExpiryNanos / 1000000000);
+	spec.it_value.tv_nsec = (long)(_nextExpiryNanos % 1000000000);
+	if (-1 == timerfd_settime(_timerFD, TFD_TIMER_ABSTIME, &spec, NULL)) {
+		if (_extensions->verbose >= 2) {
+			omrtty_printf("Unable to arm timerfd\n");
+		}
+		return false;
+	}
+
+	return alarmThread->startThread(env);
+#else /* defined(LINUX) && !defined(J9ZTPF) */
+	return false;
+#endif /* defined(LINUX) && !defined(J9ZTPF) */
+}
+
 /**
  * initialize
  * Initialize the Linux real-time clock for use by Metronome. On 
@@ -235,6 +299,45 @@ MM_RTCAlarm::sleep()
 #endif /* defined(LINUX) && !defined(J9ZTPF) */
 }
 
+/**
+ * Block until the next timer expiry and record how late the wakeup was.
+ * If the thread was delayed past one or more expiries, the lateness is measured against the
+ * most recent one, since the missed beats are not replayed.
+ */
+void
+MM_TimerFDAlarm::sleep()
+{
+#if defined(LINUX) && !defined(J9ZTPF)
+	if (!_threadPrioritySet) {
+		/* sleep() is only ever called on the alarm thread, so this is the first chance to change its policy */
+		_threadPrioritySet = true;
+		UDATA fifoPriority = MM_GCExtensions::getExtensions(_extensions)->metronomeAlarmFIFOPriority;
+		if (0 != fifoPriority) {
+			struct sched_param param;
+			param.sched_priority = (int)fifoPriority;
+			int rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+			if ((0 != rc) && (_extensions->verbose >= 1)) {
+				OMRPORT_ACCESS_FROM_OMRVM(_extensions->_omrVM);
+				omrtty_printf("Unable to set SCHED_FIFO priority %zu for the alarm thread (error %d)\n", fifoPriority, rc);
+			}
+		}
+	}
+
+	U_64 expirations = 0;
+	ssize_t readAmount = read(_timerFD, &expirations, sizeof(expirations));
+	if ((sizeof(expirations) == readAmount) && (0 != expirations)) {
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		U_64 nowNanos = ((U_64)now.tv_sec * 1000000000) + (U_64)now.tv_nsec;
+		U_64 expectedNanos = _nextExpiryNanos + ((expirations - 1) * _periodNanos);
+		_nextExpiryNanos = expectedNanos + _periodNanos;
+		_utilTracker->recordBeatJitter((nowNanos > expectedNanos) ? (nowNanos - expectedNanos) : 0);
+	} else if (-1 == readAmount) {
+		perror("blocking read failed");
+	}
+#endif /* defined(LINUX) && !defined(J9ZTPF) */
+}
+
 void
 MM_HRTAlarm::sleep()
 {
@@ -252,6 +355,11 @@ void MM_RTCAlarm::describe(OMRPortLibrary* port, char *buffer, I_32 bufferSize)
  	omrstr_printf(buffer, bufferSize, "RTC  (Period = %.2f us Frequency = %d Hz)", 1.0/_extensions->RTC_Frequency, _extensions->RTC_Frequency);
 }
 
+void MM_TimerFDAlarm::describe(OMRPortLibrary* port, char *buffer, I_32 bufferSize) {
+	OMRPORT_ACCESS_FROM_OMRPORT(port);
+	omrstr_printf(buffer, bufferSize, "timerfd (Period = %zu us, SCHED_FIFO priority = %zu)", _extensions->hrtPeriodMicro, MM_GCExtensions::getExtensions(_extensions)->metronomeAlarmFIFOPriority);
+}
+
 void MM_HRTAlarm::describe(OMRPortLibrary* port, char *buffer, I_32 bufferSize) {
 	OMRPORT_ACCESS_FROM_OMRPORT(port);
 	 omrstr_printf(buffer, bufferSize, "High Resolution Timer (Period = %d us)", _extensions->hrtPeriodMicro);
@@ -281,6 +389,21 @@ MM_Alarm::tearDown(MM_EnvironmentBase *env)
 {
 }
 
+/**
+ * tearDown
+ */
+void
+MM_TimerFDAlarm::tearDown(MM_EnvironmentBase *env)
+{
+#if defined(LINUX) && !defined(J9ZTPF)
+	if (-1 != _timerFD) {
+		close(_timerFD);
+		_timerFD = -1;
+	}
+#endif /* defined(LINUX) && !defined(J9ZTPF) */
+	MM_Alarm::tearDown(env);
+}
+
 /**
  * tearDown
  */
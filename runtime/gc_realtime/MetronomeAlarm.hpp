@@ -32,6 +32,7 @@
 class MM_EnvironmentBase;
 class MM_ProcessorInfo;
 class MM_MetronomeAlarmThread;
+class MM_UtilizationTracker;
 
 #include "omr.h"
 #include "omrcfg.h"
@@ -52,6 +53,7 @@ class MM_MetronomeAlarmThread;
  * A hi-resolution alarm that Metronome can use to gain control periodically
  * This is an abstract class - you need to create a concrete alarm which is currently
  *  one of:
+ *  MM_TimerFDAlarm (periodic CLOCK_MONOTONIC timerfd alarm - available on Linux, measures beat jitter)
  *  MM_HRTAlarm (hi-resolution timer alarm - available on some Linux and AIX variants)
  *  MM_RTCAlarm (RTC device driver alarm - available on some Linux systems when run as root or sudo)
  *  MM_ITAlarm (interval timer alarm - default if nothing else available - not very high resolution)
@@ -94,6 +96,43 @@ public:
 	virtual bool initialize(MM_EnvironmentBase *env, MM_MetronomeAlarmThread* alarmThread);
 };
 
+/**
+ * An alarm driven by a periodic, absolute CLOCK_MONOTONIC timerfd. Unlike MM_HRTAlarm, whose
+ * nanosleep() accumulates the time taken by each beat, expiries are fixed points in time, so
+ * the lateness of every wakeup can be measured and reported to the MM_UtilizationTracker.
+ */
+class MM_TimerFDAlarm : public MM_Alarm
+{
+private:
+#if defined(LINUX) && !defined(J9ZTPF)
+	int _timerFD; /**< timerfd armed with a periodic expiry of hrtPeriodMicro */
+	U_64 _periodNanos; /**< Period of the timer */
+	U_64 _nextExpiryNanos; /**< CLOCK_MONOTONIC time at which the next expiry is due */
+	bool _threadPrioritySet; /**< Set once the alarm thread has attempted to switch to SCHED_FIFO */
+#endif /* defined(LINUX) && !defined(J9ZTPF) */
+	MM_UtilizationTracker *_utilTracker; /**< Receives the measured lateness of each wakeup */
+protected:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_TimerFDAlarm * newInstance(MM_EnvironmentBase *env);
+
+	MM_TimerFDAlarm() : MM_Alarm()
+#if defined(LINUX) && !defined(J9ZTPF)
+		, _timerFD(-1)
+		, _periodNanos(0)
+		, _nextExpiryNanos(0)
+		, _threadPrioritySet(false)
+#endif /* defined(LINUX) && !defined(J9ZTPF) */
+		, _utilTracker(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+	virtual void sleep();
+	virtual void describe(OMRPortLibrary* port, char *buffer, I_32 bufferSize);
+	virtual bool initialize(MM_EnvironmentBase *env, MM_MetronomeAlarmThread* alarmThread);
+};
+
 class MM_RTCAlarm : public MM_Alarm
 {
 private:
@@ -41,6 +41,8 @@
 #include <linux/rtc.h>
 #include <sys/syscall.h>
 #include <sys/signal.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
 #elif defined(J9ZTPF)
 #include <signal.h>
 #endif /* defined(LINUX) && !defined(J9ZTPF) */
@@ -130,6 +132,30 @@ MM_OSInterface::rtcTimerAvailable() {
 #endif
 }
 
+/**
+ * timerFDAvailable
+ * On Linux, return true if a CLOCK_MONOTONIC timerfd can be created, false otherwise.
+ * Other platforms always return false.
+ * @ingroup GC_Metronome methodGroup
+ */
+bool
+MM_OSInterface::timerFDAvailable() {
+#if defined(LINUX) && !defined(J9ZTPF)
+	int fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (-1 == fd) {
+		if (_extensions->verbose >= 2) {
+			OMRPORT_ACCESS_FROM_OMRVM(_vm);
+			omrtty_printf("timerfd not available (errno %d)\n", errno);
+		}
+		return false;
+	}
+	close(fd);
+	return true;
+#else
+	return false;
+#endif
+}
+
 bool 
 MM_OSInterface::itTimerAvailable() {
 #if defined(WIN32)
@@ -74,6 +74,7 @@ public:
 	bool hiresTimerAvailable();
 	bool rtcTimerAvailable();
 	bool itTimerAvailable();
+	bool timerFDAvailable();
 	uintptr_t getNumbersOfProcessors() {return _numProcessors;}
 	
 	MM_OSInterface() :
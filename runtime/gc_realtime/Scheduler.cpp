@@ -957,6 +957,9 @@ MM_Scheduler::shutDownThreads()
 		MM_EnvironmentBase env(_vm);
 		_alarmThread->kill(&env);
 		_alarmThread = NULL;
+		if (verbose() >= 1) {
+			_utilTracker->reportBeatJitter(&env);
+		}
 	}
 
 	/* Now that the alarm and trace threads are killed, we can shutdown the master thread */
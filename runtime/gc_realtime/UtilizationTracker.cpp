@@ -82,6 +82,8 @@ MM_UtilizationTracker::initialize(MM_EnvironmentBase *env)
 	_totalSlices = UTILIZATION_WINDOW_SIZE;
 	_timeSliceDuration[_timeSliceCursor] = _timeWindow;
 	_timeSliceIsMutator[_timeSliceCursor++] = 1;
+
+	memset(_beatJitterHistogram, 0, sizeof(_beatJitterHistogram));
 	
 	return true;
 }
@@ -235,3 +237,47 @@ MM_UtilizationTracker::getNanosLeft(MM_EnvironmentRealtime *env, U_64 sliceStart
 	
 	return nanosLeft;
 }
+
+/**
+ * Records how late the alarm thread woke up for a beat.  Only called by the alarm thread, so
+ * no synchronization is required to update the histogram.
+ */
+void
+MM_UtilizationTracker::recordBeatJitter(U_64 jitterNanos)
+{
+	UDATA bucket = 0;
+	U_64 jitterMicros = jitterNanos / 1000;
+	while ((0 != jitterMicros) && (bucket < (BEAT_JITTER_HISTOGRAM_SIZE - 1))) {
+		jitterMicros >>= 1;
+		bucket += 1;
+	}
+	_beatJitterHistogram[bucket] += 1;
+	_beatCount += 1;
+	if (jitterNanos > _maxBeatJitterNanos) {
+		_maxBeatJitterNanos = jitterNanos;
+	}
+}
+
+/**
+ * Print the beat jitter histogram, if the alarm recorded any beats.
+ */
+void
+MM_UtilizationTracker::reportBeatJitter(MM_EnvironmentBase *env)
+{
+	if (0 != _beatCount) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrtty_printf("Beat jitter: %llu beats, max %llu us late, target utilization %4.1f%%, current utilization %4.1f%%\n",
+			_beatCount, _maxBeatJitterNanos / 1000, _targetUtilization * 1.0e2, _currentUtilization * 1.0e2);
+		for (UDATA bucket = 0; bucket < BEAT_JITTER_HISTOGRAM_SIZE; bucket++) {
+			if (0 != _beatJitterHistogram[bucket]) {
+				if (0 == bucket) {
+					omrtty_printf("  < 1 us: %llu\n", _beatJitterHistogram[bucket]);
+				} else if ((BEAT_JITTER_HISTOGRAM_SIZE - 1) == bucket) {
+					omrtty_printf("  >= %zu us: %llu\n", (UDATA)1 << (bucket - 1), _beatJitterHistogram[bucket]);
+				} else {
+					omrtty_printf("  %zu-%zu us: %llu\n", (UDATA)1 << (bucket - 1), ((UDATA)1 << bucket) - 1, _beatJitterHistogram[bucket]);
+				}
+			}
+		}
+	}
+}
@@ -62,6 +62,10 @@ private:
 	
 	double _timeSliceDuration[UTILIZATION_WINDOW_SIZE];   /**< How long is the time slice in seconds? */
 	bool _timeSliceIsMutator[UTILIZATION_WINDOW_SIZE];    /**< Is this time slice time spent in the mutator. */
+
+	U_64 _beatJitterHistogram[BEAT_JITTER_HISTOGRAM_SIZE]; /**< Alarm wakeups counted by how late they were (see BEAT_JITTER_HISTOGRAM_SIZE) */
+	U_64 _beatCount;                                      /**< Total number of alarm wakeups recorded */
+	U_64 _maxBeatJitterNanos;                             /**< Latest alarm wakeup seen, in nanoseconds */
 	
 protected:
 public:
@@ -86,6 +90,12 @@ public:
 	double getCurrentUtil();
 	I_64 getNanosLeft(MM_EnvironmentRealtime *env, U_64 sliceStartTimeInNanos);
 
+	void recordBeatJitter(U_64 jitterNanos);
+	void reportBeatJitter(MM_EnvironmentBase *env);
+	U_64 getBeatJitterCount(UDATA bucket) { return _beatJitterHistogram[bucket]; }
+	U_64 getBeatCount() { return _beatCount; }
+	U_64 getMaxBeatJitterNanos() { return _maxBeatJitterNanos; }
+
 	MM_UtilizationTracker(MM_EnvironmentBase *env, double timeWindow, U_64 maxGCSlice, double targetUtil)
 		: MM_BaseVirtual()
 		, _timeSliceCursor(0)
@@ -94,6 +104,8 @@ public:
 		, _maxGCSlice(maxGCSlice)
 		, _currentUtilization(1.0)
 		, _lastUpdateTime(0)
+		, _beatCount(0)
+		, _maxBeatJitterNanos(0)
 	{
 		_typeId = __FUNCTION__;
 	}
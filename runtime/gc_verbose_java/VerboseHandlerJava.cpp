@@ -44,9 +44,11 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	UDATA defaultCount = finalizeListManager->getDefaultCount();
 	UDATA referenceCount = finalizeListManager->getReferenceCount();
 	UDATA classloaderCount = finalizeListManager->getClassloaderCount();
+	/* running total, so the drain rate is the difference between two stanzas over their time delta */
+	UDATA consumedCount = finalizeListManager->getConsumedJobCount();
 
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
-		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
+		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" processed=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount, consumedCount);
 	}
 }
 
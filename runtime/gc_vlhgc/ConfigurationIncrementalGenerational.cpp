@@ -273,7 +273,10 @@ MM_ConfigurationIncrementalGenerational::initialize(MM_EnvironmentBase *env)
 	bool result = MM_Configuration::initialize(env);
 
 	if (result) {
-		extensions->scavengerScanOrdering = MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+		/* copy-forward defaults to breadth-first scanning, but honour an explicit -Xgc:hierarchicalScanOrdering */
+		if (!extensions->copyForwardScanOrderingForced) {
+			extensions->scavengerScanOrdering = MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+		}
 		extensions->setVLHGC(true);
 	}
 
@@ -167,6 +167,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _failedToExpand(false)
 	, _shouldScanFinalizableObjects(false)
 	, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
+	, _prefetchDistance(_extensions->copyForwardPrefetchDistance)
 {
 	_typeId = __FUNCTION__;
 }
@@ -2286,6 +2287,45 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 	return success;
 }
 
+MMINLINE void
+MM_CopyForwardScheme::prefetchArraySlotTarget(GC_SlotObject *slotObject)
+{
+	if (NULL != slotObject) {
+		J9Object *target = slotObject->readReferenceFromSlot();
+		if (isObjectInEvacuateMemory(target)) {
+			J9GC_PREFETCH_FOR_READ(target);
+		}
+	}
+}
+
+MMINLINE void
+MM_CopyForwardScheme::prefetchSlotTargets(MM_EnvironmentVLHGC *env, J9Object *objectPtr)
+{
+	if (NULL != objectPtr) {
+		switch(_extensions->objectModel.getScanType(objectPtr)) {
+		case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
+		case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
+		case GC_ObjectModel::SCAN_MIXED_OBJECT:
+		case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
+		case GC_ObjectModel::SCAN_REFERENCE_MIXED_OBJECT:
+		{
+			GC_MixedObjectIterator mixedObjectIterator(_javaVM->omrVM, objectPtr);
+			GC_SlotObject *slotObject = NULL;
+			while (NULL != (slotObject = mixedObjectIterator.nextSlot())) {
+				J9Object *target = slotObject->readReferenceFromSlot();
+				if (isObjectInEvacuateMemory(target)) {
+					J9GC_PREFETCH_FOR_READ(target);
+				}
+			}
+			break;
+		}
+		default:
+			/* pointer arrays prefetch their elements as they are scanned; other objects have no interesting referents */
+			break;
+		}
+	}
+}
+
 void
 MM_CopyForwardScheme::scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason)
 {
@@ -2448,12 +2488,22 @@ MM_CopyForwardScheme::scanPointerArrayObjectSlotsSplit(MM_EnvironmentVLHGC *env,
 		GC_PointerArrayIterator pointerArrayIterator(_javaVM, (J9Object *)arrayPtr);
 		pointerArrayIterator.setIndex(startIndex + slotsToScan);
 
+		/* a second iterator runs _prefetchDistance elements ahead of the scan, prefetching the referents it passes over */
+		GC_PointerArrayIterator prefetchIterator(_javaVM, (J9Object *)arrayPtr);
+		prefetchIterator.setIndex(startIndex + slotsToScan);
+		for (UDATA prefetchCount = 0; prefetchCount < OMR_MIN(_prefetchDistance, slotsToScan); prefetchCount++) {
+			prefetchArraySlotTarget(prefetchIterator.nextSlot());
+		}
+
 		for (UDATA scanCount = 0; success && (scanCount < slotsToScan); scanCount++) {
 			GC_SlotObject *slotObject = pointerArrayIterator.nextSlot();
 			if (NULL == slotObject) {
 				/* this can happen if the array is only partially allocated */
 				break;
 			}
+			if ((0 != _prefetchDistance) && ((scanCount + _prefetchDistance) < slotsToScan)) {
+				prefetchArraySlotTarget(prefetchIterator.nextSlot());
+			}
 
 			/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
 			success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, slotObject);
@@ -2937,15 +2987,22 @@ MM_CopyForwardScheme::completeScanCache(MM_EnvironmentVLHGC *env)
 		/* we want to perform a NUMA-aware analogue to "hierarchical scanning" so this scan cache should pull other objects into its node */
 		MM_AllocationContextTarok *reservingContext = getContextForHeapAddress(scanCache->scanCurrent);
 		do {
-			GC_ObjectHeapIteratorAddressOrderedList heapChunkIterator(
-				_extensions,
-				(J9Object *)scanCache->scanCurrent,
-				(J9Object *)scanCache->cacheAlloc, false);
+			J9Object *scanBase = (J9Object *)scanCache->scanCurrent;
+			J9Object *scanTop = (J9Object *)scanCache->cacheAlloc;
+			GC_ObjectHeapIteratorAddressOrderedList heapChunkIterator(_extensions, scanBase, scanTop, false);
 			/* Advance the scan pointer to the top of the cache to signify that this has been scanned */
 			scanCache->scanCurrent = scanCache->cacheAlloc;
+			/* Prefetch the referents of objects _prefetchDistance ahead of the one being scanned */
+			GC_ObjectHeapIteratorAddressOrderedList prefetchIterator(_extensions, scanBase, scanTop, false);
+			for (UDATA prefetchCount = 0; prefetchCount < _prefetchDistance; prefetchCount++) {
+				prefetchSlotTargets(env, prefetchIterator.nextObject());
+			}
 			/* Scan the chunk for all live objects */
 			J9Object *objectPtr = NULL;
 			while((objectPtr = heapChunkIterator.nextObject()) != NULL) {
+				if (0 != _prefetchDistance) {
+					prefetchSlotTargets(env, prefetchIterator.nextObject());
+				}
 				scanObject(env, reservingContext, objectPtr, SCAN_REASON_COPYSCANCACHE);
 			}
 		} while(scanCache->isScanWorkAvailable());
@@ -3099,9 +3156,21 @@ MM_CopyForwardScheme::incrementalScanCacheBySlot(MM_EnvironmentVLHGC *env)
 				(J9Object *)scanCache->scanCurrent,
 				(J9Object *)cacheAlloc,
 				false);
+			/* Prefetch the referents of objects _prefetchDistance ahead of the one being scanned */
+			GC_ObjectHeapIteratorAddressOrderedList prefetchIterator(
+				_extensions,
+				(J9Object *)scanCache->scanCurrent,
+				(J9Object *)cacheAlloc,
+				false);
+			for (UDATA prefetchCount = 0; prefetchCount < _prefetchDistance; prefetchCount++) {
+				prefetchSlotTargets(env, prefetchIterator.nextObject());
+			}
 	
 			/* Scan the chunk for live objects, incrementally slot by slot */
 			while ((objectPtr = heapChunkIterator.nextObject()) != NULL) {
+				if (0 != _prefetchDistance) {
+					prefetchSlotTargets(env, prefetchIterator.nextObject());
+				}
 				/* retrieve scan state of the scan cache */
 				switch(_extensions->objectModel.getScanType(objectPtr)) {
 				case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
@@ -158,6 +158,7 @@ private:
 	volatile bool _failedToExpand; /**< Record if we've failed to expand in this collection already, in order to avoid repeated expansion attempts */
 	bool _shouldScanFinalizableObjects; /**< Set to true at the beginning of a collection if there are any pending finalizable objects */
 	const UDATA _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
+	const UDATA _prefetchDistance; /**< Number of objects (or array elements) ahead of the scan pointer whose referents are prefetched (0 disables prefetching) */
 
 protected:
 public:
@@ -976,6 +977,21 @@ private:
 	 */
 	MMINLINE bool iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr);
 
+	/**
+	 * Issue prefetches for the objects referenced from the slots of a mixed object which is about to be scanned, so that
+	 * the headers of its children are (hopefully) in cache by the time copyAndForward() reads them.
+	 * Only referents in the evacuate set are prefetched since those are the only ones which will be copied.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] an object some distance ahead of the scan pointer (may be NULL)
+	 */
+	MMINLINE void prefetchSlotTargets(MM_EnvironmentVLHGC *env, J9Object *objectPtr);
+
+	/**
+	 * Issue a prefetch for the object referenced from a pointer array slot, if it is in the evacuate set.
+	 * @param slotObject[in] a slot some distance ahead of the array scan (may be NULL)
+	 */
+	MMINLINE void prefetchArraySlotTarget(GC_SlotObject *slotObject);
+
 protected:
 
 	MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager);
@@ -32,6 +32,11 @@
 
 #include <string.h>
 
+#if defined(_MSC_VER) || ((defined(J9X86) || defined(J9HAMMER)) && defined(__OPTIMIZE__))
+#define J9MODRON_SWEEP_USE_X86_INTRINSICS
+#include <emmintrin.h>
+#endif /* _MSC_VER || ((J9X86 || J9HAMMER) && __OPTIMIZE__) */
+
 #include "ParallelSweepSchemeVLHGC.hpp"
 #include "SweepPoolManagerAddressOrderedList.hpp"
 
@@ -73,6 +78,9 @@
 #define J9MODRON_OBM_SLOT_LAST_SLOT ((UDATA)0x80000000)
 #endif /* J9VM_ENV_DATA64 */
 
+/* Number of mark map slots tested at once when skipping empty runs (one 64 byte cache line) */
+#define J9MODRON_OBM_SLOTS_PER_SCAN_BLOCK (64 / sizeof(UDATA))
+
 /**
  * Run the sweep task.
  * Skeletal code to run the sweep task per work thread.  No actual work done.
@@ -381,6 +389,45 @@ MM_ParallelSweepSchemeVLHGC::setupForSweep(MM_EnvironmentVLHGC *env)
  ****************************************
  */
 
+/**
+ * Find the end of a run of empty mark map slots.
+ * Whole cache lines of the mark map are tested at a time (with SSE2 where available, otherwise by
+ * OR-ing the slots together), so that sparse regions of a large heap are crossed without a compare
+ * and branch per slot.  The remainder is finished one slot at a time.
+ * @param markMapCurrent the first slot to test
+ * @param markMapChunkTop the slot at which to stop searching
+ * @return the first non-empty slot at or after markMapCurrent, or markMapChunkTop if there is none
+ */
+MMINLINE UDATA *
+MM_ParallelSweepSchemeVLHGC::skipEmptyMarkMapSlots(UDATA *markMapCurrent, UDATA *markMapChunkTop)
+{
+	while ((markMapCurrent + J9MODRON_OBM_SLOTS_PER_SCAN_BLOCK) <= markMapChunkTop) {
+#if defined(J9MODRON_SWEEP_USE_X86_INTRINSICS)
+		__m128i *block = (__m128i *)markMapCurrent;
+		__m128i bits = _mm_or_si128(
+				_mm_or_si128(_mm_loadu_si128(block), _mm_loadu_si128(block + 1)),
+				_mm_or_si128(_mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) {
+			break;
+		}
+#else /* J9MODRON_SWEEP_USE_X86_INTRINSICS */
+		UDATA bits = J9MODRON_OBM_SLOT_EMPTY;
+		for (UDATA i = 0; i < J9MODRON_OBM_SLOTS_PER_SCAN_BLOCK; i++) {
+			bits |= markMapCurrent[i];
+		}
+		if (J9MODRON_OBM_SLOT_EMPTY != bits) {
+			break;
+		}
+#endif /* J9MODRON_SWEEP_USE_X86_INTRINSICS */
+		markMapCurrent += J9MODRON_OBM_SLOTS_PER_SCAN_BLOCK;
+	}
+
+	while ((markMapCurrent < markMapChunkTop) && (J9MODRON_OBM_SLOT_EMPTY == *markMapCurrent)) {
+		markMapCurrent += 1;
+	}
+	return markMapCurrent;
+}
+
 MMINLINE void
 MM_ParallelSweepSchemeVLHGC::sweepMarkMapBody(
 	UDATA * &markMapCurrent,
@@ -394,14 +441,7 @@ MM_ParallelSweepSchemeVLHGC::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = skipEmptyMarkMapSlots(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -131,6 +131,7 @@ protected:
 
 	void initializeSweepChunkTable(MM_EnvironmentVLHGC *env);
 
+	UDATA *skipEmptyMarkMapSlots(UDATA *markMapCurrent, UDATA *markMapChunkTop);
 	void sweepMarkMapBody(UDATA * &markMapCurrent, UDATA * &markMapChunkTop, UDATA * &markMapFreeHead, UDATA &heapSlotFreeCount, UDATA * &heapSlotFreeCurrent, UDATA * &heapSlotFreeHead);
 	void sweepMarkMapHead(UDATA *markMapFreeHead, UDATA *markMapChunkBase, UDATA * &heapSlotFreeHead, UDATA &heapSlotFreeCount);
 	void sweepMarkMapTail(UDATA *markMapCurrent, UDATA *markMapChunkTop, UDATA &heapSlotFreeCount);
@@ -183,8 +183,9 @@ enum {
  */ 
 
 enum {
-	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID = 0,
-	COM_IBM_JLM_DUMP_FORMAT_TAGS      = 1
+	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID   = 0,
+	COM_IBM_JLM_DUMP_FORMAT_TAGS        = 1,
+	COM_IBM_JLM_DUMP_FORMAT_CLASS_STATS = 2		/** Object monitor statistics summed by the class of the locked object */
 };
 
 
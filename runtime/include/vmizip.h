@@ -122,6 +122,7 @@ typedef struct VMIZipFunctionTable {
 
 	/* J9 specific, keep these at the end */
 	struct J9HookInterface** (*zip_getZipHookInterface) (VMInterface * vmi) ;
+	I_32 (*zip_getZipEntryDataPointer) (VMInterface * vmi, VMIZipFile * zipFile, VMIZipEntry * entry, U_8 ** data) ;
 
 	void *reserved;
 } VMIZipFunctionTable;
@@ -72,6 +72,7 @@ typedef struct J9ZipFunctionTable {
 	I_32 (*zip_getZipEntry)(J9PortLibrary *portLib, J9ZipFile *zipFile, J9ZipEntry *entry, const char *filename, IDATA fileNameLength, U_32 flags);
 	I_32 (*zip_getZipEntryComment)(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry * entry, U_8 * buffer, U_32 bufferSize);
 	I_32 (*zip_getZipEntryData)(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize);
+	I_32 (*zip_getZipEntryDataPointer)(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data);
 	I_32 (*zip_getZipEntryExtraField)(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize);
 	I_32 (*zip_getZipEntryFromOffset)(J9PortLibrary * portLib, J9ZipFile * zipFile, J9ZipEntry * entry, IDATA offset, BOOLEAN readDataPointer);
 	I_32 (*zip_getZipEntryRawData)(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize, U_32 offset);
@@ -182,6 +183,15 @@ BOOLEAN
 zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameLength, UDATA elementOffset);
 
 
+/**
+* @brief
+* @param zipCache
+* @return BOOLEAN
+*/
+BOOLEAN
+zipCache_buildIndexes(J9ZipCache * zipCache);
+
+
 /**
 * @brief
 * @param *handle
@@ -467,6 +477,18 @@ I_32
 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize);
 
 
+/**
+* @brief
+* @param portLib
+* @param zipFile
+* @param entry
+* @param data
+* @return I_32
+*/
+I_32 
+zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data);
+
+
 /**
 * @brief
 * @param portLib
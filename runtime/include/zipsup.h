@@ -148,16 +148,26 @@ typedef struct J9ZipFileRecord {
 
 #define J9ZIPFILERECORD_NEXT(base) WSRP_GET((base)->next, struct J9ZipFileRecord*)
 
+typedef struct J9ZipIndex {
+    UDATA slotCount;
+    UDATA entryCount;
+    J9WSRP slots[1];
+} J9ZipIndex;
+
 typedef struct J9ZipDirEntry {
     J9WSRP next;
     J9WSRP fileList;
     J9WSRP dirList;
+    J9WSRP fileIndex;
+    J9WSRP dirIndex;
     UDATA zipFileOffset;
 } J9ZipDirEntry;
 
 #define J9ZIPDIRENTRY_NEXT(base) WSRP_GET((base)->next, struct J9ZipDirEntry*)
 #define J9ZIPDIRENTRY_FILELIST(base) WSRP_GET((base)->fileList, struct J9ZipFileRecord*)
 #define J9ZIPDIRENTRY_DIRLIST(base) WSRP_GET((base)->dirList, struct J9ZipDirEntry*)
+#define J9ZIPDIRENTRY_FILEINDEX(base) WSRP_GET((base)->fileIndex, struct J9ZipIndex*)
+#define J9ZIPDIRENTRY_DIRINDEX(base) WSRP_GET((base)->dirIndex, struct J9ZipIndex*)
 
 typedef struct J9ZipCacheEntry {
     J9WSRP zipFileName;
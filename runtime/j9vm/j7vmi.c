@@ -433,6 +433,9 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 		UDATA flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_SKIP_INLINES;
 		J9StackWalkState* walkState = currentThread->stackWalkState;
 		j9object_t result = (j9object_t) J9VMJAVALANGTHROWABLE_WALKBACK(currentThread, unwrappedThrowable);
+		/* Only share arrays for new walkbacks: an existing walkback may be refilled in place */
+		BOOLEAN internTrace = (NULL == result) && (NULL != javaVM->walkbackInternTable);
+		UDATA internHash = 0;
 		UDATA rc;
 		UDATA i;
 		UDATA framesWalked;
@@ -466,6 +469,12 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 #else
 			J9Class* arrayClass = javaVM->intArrayClass;
 #endif
+			if (internTrace) {
+				result = vmfns->findInternedWalkback(currentThread, walkState->cache, framesWalked, &internHash);
+				if (NULL != result) {
+					goto walkbackFilled;
+				}
+			}
 			result = javaVM->memoryManagerFunctions->J9AllocateIndexableObject(currentThread, arrayClass, (U_32)framesWalked, J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
 			if (NULL == result) {
 				vmfns->setHeapOutOfMemoryError(currentThread);
@@ -483,7 +492,11 @@ JVM_FillInStackTrace(JNIEnv* env, jobject throwable)
 		for (i = 0; i < framesWalked; ++i) {
 			J9JAVAARRAYOFUDATA_STORE(currentThread, result, i, walkState->cache[i]);
 		}
+		if (internTrace) {
+			vmfns->internWalkback(currentThread, result, internHash);
+		}
 
+walkbackFilled:
 		vmfns->freeStackWalkCaches(currentThread, walkState);
 
 setThrowableSlots:
@@ -34,6 +34,21 @@
 
 
 
+typedef struct J9StackTraceHandshakeData {
+	J9StackWalkState *walkState;
+	UDATA rc;
+} J9StackTraceHandshakeData;
+
+/* Handshake function: walk the stack of the halted target thread, caching the PCs */
+static void
+cacheStackTracePCs(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	J9StackTraceHandshakeData *data = (J9StackTraceHandshakeData *)userData;
+
+	data->walkState->walkThread = targetThread;
+	data->rc = currentThread->javaVM->walkStackFrames(currentThread, data->walkState);
+}
+
 j9object_t
 getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDATA skipCount)
 {
@@ -41,19 +56,16 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	J9InternalVMFunctions * vmfns = vm->internalVMFunctions;
 	j9object_t throwable = NULL;
 	J9StackWalkState walkState;
+	J9StackTraceHandshakeData data;
 	UDATA rc;
 
-	/* Halt the target thread */
-	vmfns->haltThreadForInspection(currentThread, targetThread);
-
-	/* walk stack and cache PCs */
-	walkState.walkThread = targetThread;
+	/* Halt only the target thread while its stack is walked and the PCs cached */
 	walkState.flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
 	walkState.skipCount = skipCount;
-	rc = vm->walkStackFrames(currentThread, &walkState);
-
-	/* Now that the stack trace has been copied, resume the thread */
-	vmfns->resumeThreadForInspection(currentThread, targetThread);
+	data.walkState = &walkState;
+	data.rc = J9_STACKWALK_RC_NONE;
+	vmfns->handshakeThread(currentThread, targetThread, cacheStackTracePCs, &data);
+	rc = data.rc;
 
 	/* Check for stack walk failure */
 	if (rc != J9_STACKWALK_RC_NONE) {
@@ -103,6 +103,13 @@ typedef struct ThreadInfo {
 	} lockedSynchronizers;
 } ThreadInfo;
 
+typedef struct ThreadInfoHandshakeData {
+	ThreadInfo *info;
+	jint maxStackDepth;
+	jboolean getLockedMonitors;
+	IDATA exc;
+} ThreadInfoHandshakeData;
+
 typedef struct SynchronizerIterData {
 	ThreadInfo *allinfo;
 	UDATA allinfolen;
@@ -123,7 +130,9 @@ static jlong getCurrentThreadUserTime(omrthread_t self);
 static jint initIDCache(JNIEnv *env);
 
 static ThreadInfo *getArrayOfThreadInfo(JNIEnv *env, jlong *threadIDs, jint numThreads, jint maxStackDepth, jboolean getLockedMonitors, jboolean getLockedSynchronizers);
-static IDATA getThreadInfo(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *info, jint maxStackDepth, jboolean getLockedMonitors);
+static ThreadInfo *getOneThreadInfo(J9VMThread *currentThread, jlong threadID, jint maxStackDepth, jboolean getLockedMonitors);
+static void getThreadInfoHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData);
+static IDATA getThreadInfo(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *info, jint maxStackDepth, jboolean getLockedMonitors, jboolean globalRefs);
 static void getContentionStats(J9VMThread *currentThread, J9VMThread *vmThread, ThreadInfo *tinfo);
 static IDATA getStackFramePCs(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *tinfo, jint maxStackDepth);
 static IDATA getMonitors(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *tinfo, UDATA stackLen);
@@ -131,7 +140,10 @@ static UDATA getSynchronizers(J9VMThread *currentThread, ThreadInfo *allinfo, UD
 static jvmtiIterationControl getSynchronizersHeapIterator(J9VMThread *vmThread, J9MM_IterateObjectDescriptor *objectDesc, void *userData);
 
 static void freeThreadInfos(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen);
-static IDATA saveObjectRefs(JNIEnv *env, ThreadInfo *info);
+static IDATA saveObjectRefs(JNIEnv *env, ThreadInfo *info, jboolean globalRefs);
+static jobject createInfoRef(J9VMThread *currentThread, j9object_t object, jboolean globalRefs);
+static void localizeObjectRefs(JNIEnv *env, ThreadInfo *info);
+static jobject localizeRef(JNIEnv *env, jobject globalRef);
 
 static jobject createThreadInfo(JNIEnv *env, ThreadInfo *tinfo, jsize maxStackDepth);
 static jobjectArray createThreadInfoArray(JNIEnv *env, ThreadInfo *allinfo, UDATA allinfolen, jsize maxStackDepth);
@@ -817,6 +829,19 @@ getArrayOfThreadInfo(JNIEnv *env,
 	}
 
 	vmfns->internalEnterVMFromJNI(currentThread);
+
+	if ((1 == numThreads) && (JNI_TRUE != getLockedSynchronizers)) {
+		/* A single thread only needs to be halted itself, not the whole VM.
+		 * Locked synchronizers are found by walking the heap, which still requires exclusive VM access.
+		 */
+		allinfo = getOneThreadInfo(currentThread, threadIDs[0], maxStackDepth, getLockedMonitors);
+		if (NULL == allinfo) {
+			vmfns->internalExitVMToJNI(currentThread);
+			return NULL;
+		}
+		goto getArray_createStackTraces;
+	}
+
 	vmfns->acquireExclusiveVMAccess(currentThread);
 
 	/** 
@@ -847,7 +872,7 @@ getArrayOfThreadInfo(JNIEnv *env,
 
 			if (threadIDs[i]) {
 				exc = getThreadInfo(currentThread, (J9VMThread *)(UDATA)threadIDs[i],
-						&allinfo[i], maxStackDepth, getLockedMonitors);
+						&allinfo[i], maxStackDepth, getLockedMonitors, JNI_FALSE);
 				if (exc > 0) {
 					freeThreadInfos(currentThread, allinfo, numThreads);
 					goto getArray_failWithExclusive;
@@ -871,7 +896,7 @@ getArrayOfThreadInfo(JNIEnv *env,
 		 * walking its own stack
 		 */
 		if (allinfo[i].thread) {
-			exc = saveObjectRefs(env, &allinfo[i]);
+			exc = saveObjectRefs(env, &allinfo[i], JNI_FALSE);
 			if (exc > 0) {
 				freeThreadInfos(currentThread, allinfo, numThreads);
 				goto getArray_failWithExclusive;
@@ -881,6 +906,7 @@ getArrayOfThreadInfo(JNIEnv *env,
 
 	vmfns->releaseExclusiveVMAccess(currentThread);
 
+getArray_createStackTraces:
 	for (i = 0; (jint)i < numThreads; ++i) {
 		/* allocates objects, may set exception */
 		if (allinfo[i].thread) {
@@ -905,6 +931,99 @@ getArray_failWithExclusive:
 	return NULL;
 }
 
+/**
+ * Populate the ThreadInfo for a single thread, halting only that thread
+ * instead of acquiring exclusive VM access.
+ * Locked synchronizers are not discovered.
+ *
+ * @pre VM access
+ * @param[in] currentThread
+ * @param[in] threadID ID of the thread to be examined. May be a dead thread.
+ * @param[in] maxStackDepth A guideline for limiting the number of stack frames walked.
+ * @param[in] getLockedMonitors Whether locked monitors should be discovered.
+ *
+ * @return array of one ThreadInfo, whose thread is NULL if the thread is dead
+ * @retval non-NULL success
+ * @retval NULL error, an exception is set
+ */
+static ThreadInfo *
+getOneThreadInfo(J9VMThread *currentThread, jlong threadID, jint maxStackDepth, jboolean getLockedMonitors)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	J9JavaVM *vm = currentThread->javaVM;
+	J9VMThread *targetThread = NULL;
+	ThreadInfo *info = NULL;
+	IDATA exc = 0;
+
+	info = j9mem_allocate_memory(sizeof(ThreadInfo), J9MEM_CATEGORY_VM_JCL);
+	if (NULL == info) {
+		throwError(currentThread, J9VMCONSTANTPOOL_JAVALANGOUTOFMEMORYERROR);
+		return NULL;
+	}
+	memset(info, 0, sizeof(ThreadInfo));
+
+	/* Make sure the target thread stays alive while it is being inspected */
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	targetThread = getThread((JNIEnv *)currentThread, threadID);
+	if (NULL != targetThread) {
+		targetThread->inspectorCount += 1;
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+
+	if (NULL != targetThread) {
+		ThreadInfoHandshakeData data;
+
+		data.info = info;
+		data.maxStackDepth = maxStackDepth;
+		data.getLockedMonitors = getLockedMonitors;
+		data.exc = 0;
+		vm->internalVMFunctions->handshakeThread(currentThread, targetThread, getThreadInfoHandshake, &data);
+		exc = data.exc;
+
+		omrthread_monitor_enter(vm->vmThreadListMutex);
+		targetThread->inspectorCount -= 1;
+		if (0 == targetThread->inspectorCount) {
+			omrthread_monitor_notify_all(vm->vmThreadListMutex);
+		}
+		omrthread_monitor_exit(vm->vmThreadListMutex);
+
+		/* Also deletes the global refs of a partially populated ThreadInfo */
+		localizeObjectRefs((JNIEnv *)currentThread, info);
+		if (exc > 0) {
+			freeThreadInfos(currentThread, info, 1);
+			throwError(currentThread, exc);
+			return NULL;
+		}
+	}
+
+	return info;
+}
+
+/**
+ * Handshake function: populate the ThreadInfo of the halted target thread.
+ * While the target is halted the current thread must not create local refs,
+ * so object references are saved as global refs.
+ * @param[in] currentThread
+ * @param[in] targetThread The halted thread.
+ * @param[in] userData The ThreadInfoHandshakeData.
+ * @return n/a
+ */
+static void
+getThreadInfoHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	ThreadInfoHandshakeData *data = (ThreadInfoHandshakeData *)userData;
+	J9JavaVM *vm = currentThread->javaVM;
+
+	/* The owner of the target thread's blocking object must not exit while it is examined */
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	data->exc = getThreadInfo(currentThread, targetThread, data->info,
+			data->maxStackDepth, data->getLockedMonitors, JNI_TRUE);
+	if (0 == data->exc) {
+		data->exc = saveObjectRefs((JNIEnv *)currentThread, data->info, JNI_TRUE);
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+}
+
 /**
  * Get the tid of a thread object (equivalent of Thread.getId())
  * 
@@ -1298,7 +1417,8 @@ freeThreadInfos(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen
  * @pre VM access.
  * @pre The target thread must be halted.
  * @pre The owner of the target thread's blocking object must not be able to exit. 
- * This usually implies that exclusive VM access is required.
+ * This usually implies that exclusive VM access is required, or that the
+ * target thread is halted and vmThreadListMutex is held.
  * 
  * @param[in] currentThread
  * @param[in] targetThread The thread to be examined.
@@ -1306,6 +1426,7 @@ freeThreadInfos(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen
  * @param[in] maxStackDepth A guideline for limiting the number of stack frames walked.
  * The returned stack trace may have more frames.
  * @param[in] getLockedMonitors Whether locked monitors should be discovered.
+ * @param[in] globalRefs Whether object references are saved as global refs instead of local refs.
  * 
  * @return error status
  * @retval 0 success
@@ -1313,11 +1434,8 @@ freeThreadInfos(J9VMThread *currentThread, ThreadInfo *allinfo, UDATA allinfolen
  */
 static IDATA
 getThreadInfo(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *info,
-		jint maxStackDepth, jboolean getLockedMonitors)
+		jint maxStackDepth, jboolean getLockedMonitors, jboolean globalRefs)
 {
-	J9JavaVM *vm = currentThread->javaVM;
-	J9InternalVMFunctions *vmfns = vm->internalVMFunctions;
-
 	j9object_t monitorObject = NULL;
 	J9VMThread *monitorOwner = NULL;
 	j9object_t monitorOwnerObject = NULL;
@@ -1325,8 +1443,7 @@ getThreadInfo(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *i
 
 	Trc_JCL_threadmxbean_getThreadInfo_Entry(currentThread, targetThread);
 
-	info->thread =
-		vmfns->j9jni_createLocalRef((JNIEnv *)currentThread, (j9object_t)targetThread->threadObject);
+	info->thread = createInfoRef(currentThread, (j9object_t)targetThread->threadObject, globalRefs);
 	/* Set the native thread ID available through the thread library. */
 	info->nativeTID = (jlong) omrthread_get_osId(targetThread->osThread);
 	info->vmstate = getVMThreadObjectState(targetThread, &monitorObject, &monitorOwner, NULL);
@@ -1345,8 +1462,8 @@ getThreadInfo(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo *i
 		info->vmstate = J9VMTHREAD_STATE_RUNNING;
 		monitorObject = NULL;
 	}
-	info->blocker = vmfns->j9jni_createLocalRef((JNIEnv *)currentThread, monitorObject);
-	info->blockerOwner = vmfns->j9jni_createLocalRef((JNIEnv *)currentThread, monitorOwnerObject);
+	info->blocker = createInfoRef(currentThread, monitorObject, globalRefs);
+	info->blockerOwner = createInfoRef(currentThread, monitorOwnerObject, globalRefs);
 
 	/* this may block on vm->managementDataLock */
 	getContentionStats(currentThread, targetThread, info);
@@ -2022,15 +2139,15 @@ pruneStackTrace(JNIEnv *env, jobjectArray stackTrace, jsize maxStackDepth)
  * @pre VM access
  * @param[in] env
  * @param[in] info
+ * @param[in] globalRefs Whether global refs are created instead of local refs.
  * @return error status
  * @retval 0 success
  * @retval >0 error, the index of a known exception
  */
 static IDATA
-saveObjectRefs(JNIEnv *env, ThreadInfo *info)
+saveObjectRefs(JNIEnv *env, ThreadInfo *info, jboolean globalRefs)
 {
 	J9JavaVM * vm = ((J9VMThread *)env)->javaVM;
-	J9InternalVMFunctions *vmfns = vm->internalVMFunctions;
 	SynchronizerInfo *sinfo;
 	UDATA i;
 	IDATA exc = 0;
@@ -2042,8 +2159,8 @@ saveObjectRefs(JNIEnv *env, ThreadInfo *info)
 			for (i = 0; i < info->lockedMonitors.len; ++i) {
 				j9object_t object = info->lockedMonitors.arr_unsafe[i].object;
 
-				info->lockedMonitors.arr_safe[i].clazz =
-					vmfns->j9jni_createLocalRef(env, J9VM_J9CLASS_TO_HEAPCLASS(J9OBJECT_CLAZZ((J9VMThread *)env, object)));
+				info->lockedMonitors.arr_safe[i].clazz = createInfoRef((J9VMThread *)env,
+					J9VM_J9CLASS_TO_HEAPCLASS(J9OBJECT_CLAZZ((J9VMThread *)env, object)), globalRefs);
 				info->lockedMonitors.arr_safe[i].identityHashCode = objectHashCode(vm, object);
 				info->lockedMonitors.arr_safe[i].count = info->lockedMonitors.arr_unsafe[i].count;
 				info->lockedMonitors.arr_safe[i].depth = info->lockedMonitors.arr_unsafe[i].depth;
@@ -2059,7 +2176,7 @@ saveObjectRefs(JNIEnv *env, ThreadInfo *info)
 		if (info->lockedSynchronizers.len > 0) {
 			sinfo = info->lockedSynchronizers.list;
 			while (sinfo) {
-				sinfo->obj.safe = vmfns->j9jni_createLocalRef(env, sinfo->obj.unsafe);
+				sinfo->obj.safe = createInfoRef((J9VMThread *)env, sinfo->obj.unsafe, globalRefs);
 				sinfo = sinfo->next;
 			}
 		}
@@ -2068,6 +2185,73 @@ saveObjectRefs(JNIEnv *env, ThreadInfo *info)
 	return exc;
 }
 
+/**
+ * Create a local or global ref for an object saved in a ThreadInfo.
+ * @pre VM access
+ * @param[in] currentThread
+ * @param[in] object The object. May be NULL.
+ * @param[in] globalRefs Whether a global ref is created instead of a local ref.
+ * @return the new ref, or NULL if object is NULL
+ */
+static jobject
+createInfoRef(J9VMThread *currentThread, j9object_t object, jboolean globalRefs)
+{
+	J9InternalVMFunctions *vmfns = currentThread->javaVM->internalVMFunctions;
+	jobject ref = NULL;
+
+	if (JNI_TRUE == globalRefs) {
+		if (NULL != object) {
+			ref = vmfns->j9jni_createGlobalRef((JNIEnv *)currentThread, object, JNI_FALSE);
+		}
+	} else {
+		ref = vmfns->j9jni_createLocalRef((JNIEnv *)currentThread, object);
+	}
+	return ref;
+}
+
+/**
+ * Replace the global refs created by saveObjectRefs() and getThreadInfo()
+ * with local refs, once no other thread is halted by the current thread.
+ * @pre VM access
+ * @param[in] env
+ * @param[in] info
+ * @return n/a
+ */
+static void
+localizeObjectRefs(JNIEnv *env, ThreadInfo *info)
+{
+	UDATA i;
+
+	info->thread = localizeRef(env, info->thread);
+	info->blocker = localizeRef(env, info->blocker);
+	info->blockerOwner = localizeRef(env, info->blockerOwner);
+	if (NULL != info->lockedMonitors.arr_safe) {
+		for (i = 0; i < info->lockedMonitors.len; ++i) {
+			info->lockedMonitors.arr_safe[i].clazz = localizeRef(env, info->lockedMonitors.arr_safe[i].clazz);
+		}
+	}
+}
+
+/**
+ * Replace a global ref with a local ref to the same object.
+ * @pre VM access
+ * @param[in] env
+ * @param[in] globalRef The global ref, which is deleted. May be NULL.
+ * @return the local ref, or NULL if globalRef is NULL
+ */
+static jobject
+localizeRef(JNIEnv *env, jobject globalRef)
+{
+	J9InternalVMFunctions *vmfns = ((J9VMThread *)env)->javaVM->internalVMFunctions;
+	jobject localRef = NULL;
+
+	if (NULL != globalRef) {
+		localRef = vmfns->j9jni_createLocalRef(env, J9OBJECT_FROM_JOBJECT(globalRef));
+		vmfns->j9jni_deleteGlobalRef(env, globalRef, JNI_FALSE);
+	}
+	return localRef;
+}
+
 /**
  * Returns stackTrace[0].isNativeMethod()
  * @pre must not have VM access
@@ -140,7 +140,12 @@ jitGetInterfaceVTableOffsetFromCP(J9VMThread *currentThread, J9ConstantPool *con
 	UDATA iTableIndex = 0;
 	J9Class *interfaceClass = jitGetInterfaceITableIndexFromCP(currentThread, constantPool, cpIndex, &iTableIndex);
 	if (NULL != interfaceClass) {
-		J9ITable * iTable = lookupClass->lastITable;
+		J9ITable * iTable = J9_ITABLE_DISPATCH_PROBE(lookupClass, interfaceClass);
+		if (interfaceClass == iTable->interfaceClass) {
+			goto foundITable;
+		}
+		/* An interface whose dispatch slot is taken by another may still be the last one found in the list */
+		iTable = lookupClass->lastITable;
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
@@ -327,7 +327,7 @@ jvmtiGetLineNumberTable(jvmtiEnv* env,
 			}
 		}
 release:
-		releaseOptInfoBuffer(vm, J9_CLASS_FROM_METHOD(ramMethod)->romClass);
+		releaseMethodDebugInfo(vm, J9_CLASS_FROM_METHOD(ramMethod)->romClass, methodDebugInfo);
 	}
 
 done:
@@ -464,7 +464,7 @@ jvmtiGetLocalVariableTable(jvmtiEnv* env,
 			}
 		}
 release:
-		releaseOptInfoBuffer(vm, J9_CLASS_FROM_METHOD(ramMethod)->romClass);
+		releaseMethodDebugInfo(vm, J9_CLASS_FROM_METHOD(ramMethod)->romClass, methodDebugInfo);
 	}
 
 done:
@@ -26,6 +26,16 @@
 static UDATA popFrameCheckIterator (J9VMThread * currentThread, J9StackWalkState * walkState);
 static UDATA jvmtiInternalGetStackTraceIterator (J9VMThread * currentThread, J9StackWalkState * walkState);
 static jvmtiError jvmtiInternalGetStackTrace(jvmtiEnv* env, J9VMThread * currentThread, J9VMThread * targetThread, jint start_depth, UDATA max_frame_count, jvmtiFrameInfo* frame_buffer, jint* count_ptr);
+static void countFramesHandshake (J9VMThread * currentThread, J9VMThread * targetThread, void * userData);
+static void getStackInfoHandshake (J9VMThread * currentThread, J9VMThread * targetThread, void * userData);
+static jvmtiError jvmtiInternalGetOneThreadStackTrace(jvmtiEnv* env, J9VMThread * currentThread, jthread thread, jint max_frame_count, jvmtiStackInfo ** stack_info_ptr);
+
+typedef struct J9JVMTIStackInfoHandshakeData {
+	jvmtiEnv * env;
+	jint maxFrameCount;
+	jvmtiStackInfo * stackInfo;
+	jvmtiError rc;
+} J9JVMTIStackInfoHandshakeData;
 
 
 jvmtiError JNICALL
@@ -190,6 +200,12 @@ jvmtiGetThreadListStackTraces(jvmtiEnv* env,
 		ENSURE_NON_NEGATIVE(max_frame_count);
 		ENSURE_NON_NULL(stack_info_ptr);
 
+		if (1 == thread_count) {
+			/* A single thread only needs to be halted itself, not the whole VM */
+			rc = jvmtiInternalGetOneThreadStackTrace(env, currentThread, *thread_list, max_frame_count, &rv_stack_info);
+			goto done;
+		}
+
 		vm->internalVMFunctions->acquireExclusiveVMAccess(currentThread);
 
 		stackInfo = j9mem_allocate_memory(((sizeof(jvmtiStackInfo) + (max_frame_count * sizeof(jvmtiFrameInfo))) * thread_count) + sizeof(jlocation), J9MEM_CATEGORY_JVMTI_ALLOCATE);
@@ -284,15 +300,11 @@ jvmtiGetFrameCount(jvmtiEnv* env,
 		if (rc == JVMTI_ERROR_NONE) {
 			J9StackWalkState walkState;
 
-			vm->internalVMFunctions->haltThreadForInspection(currentThread, targetThread);
-
-			walkState.walkThread = targetThread;
 			walkState.flags = J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
 			walkState.skipCount = 0;
-			vm->walkStackFrames(currentThread, &walkState);
+			vm->internalVMFunctions->handshakeThread(currentThread, targetThread, countFramesHandshake, &walkState);
 			rv_count = (jint) walkState.framesWalked;
 
-			vm->internalVMFunctions->resumeThreadForInspection(currentThread, targetThread);
 			releaseVMThread(currentThread, targetThread);
 		}
 done:
@@ -305,6 +317,89 @@ done:
 	TRACE_JVMTI_RETURN(jvmtiGetFrameCount);
 }
 
+/* Handshake function: record the stack trace and state of the halted target thread */
+static void
+getStackInfoHandshake(J9VMThread * currentThread, J9VMThread * targetThread, void * userData)
+{
+	J9JVMTIStackInfoHandshakeData * data = (J9JVMTIStackInfoHandshakeData *) userData;
+	jvmtiStackInfo * stackInfo = data->stackInfo;
+
+	data->rc = jvmtiInternalGetStackTrace(data->env,
+	                                      currentThread,
+	                                      targetThread,
+	                                      0,
+	                                      (UDATA) data->maxFrameCount,
+	                                      stackInfo->frame_buffer,
+	                                      &(stackInfo->frame_count));
+	stackInfo->state = getThreadState(currentThread, targetThread->threadObject);
+}
+
+
+/**
+ * The one thread case of GetThreadListStackTraces. Only the target thread is halted while
+ * its stack is walked, instead of acquiring exclusive VM access.
+ * The caller has VM access and has validated max_frame_count.
+ */
+static jvmtiError
+jvmtiInternalGetOneThreadStackTrace(jvmtiEnv* env, J9VMThread * currentThread, jthread thread, jint max_frame_count, jvmtiStackInfo ** stack_info_ptr)
+{
+	J9JavaVM * vm = currentThread->javaVM;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	jvmtiStackInfo * stackInfo = NULL;
+	J9VMThread * targetThread = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (thread == NULL) {
+		return JVMTI_ERROR_NULL_POINTER;
+	}
+	if (!isSameOrSuperClassOf(J9VMJAVALANGTHREAD_OR_NULL(vm), J9OBJECT_CLAZZ(currentThread, *((j9object_t *) thread)))) {
+		return JVMTI_ERROR_INVALID_THREAD;
+	}
+
+	stackInfo = j9mem_allocate_memory(sizeof(jvmtiStackInfo) + (max_frame_count * sizeof(jvmtiFrameInfo)) + sizeof(jlocation), J9MEM_CATEGORY_JVMTI_ALLOCATE);
+	if (stackInfo == NULL) {
+		return JVMTI_ERROR_OUT_OF_MEMORY;
+	}
+	stackInfo->thread = thread;
+	stackInfo->frame_buffer = (jvmtiFrameInfo *) ((((UDATA) (stackInfo + 1)) + sizeof(jlocation)) & ~sizeof(jlocation));
+	stackInfo->frame_count = 0;
+
+	/* A thread which is not alive has no frames */
+	rc = getVMThread(currentThread, thread, &targetThread, FALSE, FALSE);
+	if ((rc == JVMTI_ERROR_NONE) && (targetThread != NULL)) {
+		J9JVMTIStackInfoHandshakeData data;
+
+		data.env = env;
+		data.maxFrameCount = max_frame_count;
+		data.stackInfo = stackInfo;
+		data.rc = JVMTI_ERROR_NONE;
+		vm->internalVMFunctions->handshakeThread(currentThread, targetThread, getStackInfoHandshake, &data);
+		rc = data.rc;
+		releaseVMThread(currentThread, targetThread);
+	} else if (rc == JVMTI_ERROR_NONE) {
+		stackInfo->state = getThreadState(currentThread, *((j9object_t *) thread));
+	}
+
+	if (rc != JVMTI_ERROR_NONE) {
+		j9mem_free_memory(stackInfo);
+		stackInfo = NULL;
+	}
+	*stack_info_ptr = stackInfo;
+	return rc;
+}
+
+
+/* Handshake function: walk the stack of the halted target thread to count its frames */
+static void
+countFramesHandshake(J9VMThread * currentThread, J9VMThread * targetThread, void * userData)
+{
+	J9StackWalkState * walkState = (J9StackWalkState *) userData;
+
+	walkState->walkThread = targetThread;
+	currentThread->javaVM->walkStackFrames(currentThread, walkState);
+}
+
+
 /**
  * Pops the top frame off the stack, leaving execution state immediately before
  * the invoke.  Resuming the thread will result in the method being reinvoked.
@@ -37,3 +37,4 @@
 #define BCT_ERR_LINE_NUMBER_TABLE_DECOMPRESS_FAILED -14
 #define BCT_ERR_INVALID_BYTECODE_SIZE -15
 #define BCT_ERR_GENERIC_ERROR_CUSTOM_MSG  -16
+#define BCT_ERR_CLASS_ALREADY_DEFINED  -17
@@ -237,8 +237,9 @@ internalLoadROMClass(J9VMThread *vmThread, J9LoadROMClassData *loadData, J9Trans
  * Searches for the definition of the class called className in the patch path of the module, or the classPath.
  * It first searches the patch path of the module to which the class belongs.
  * If the definition is not found, then it examines the classPath entries in turn.
- * If a class is located copy the contents and size of the Sun
- * format class file into the sunClassFileBuffer element of the global vm translation buffers.
+ * If a class is located, the currentSunClassFileData and currentSunClassFileSize elements of the
+ * global vm translation buffers describe the Sun format class file. The data is either copied into
+ * sunClassFileBuffer or, for uncompressed jar and jimage entries, points into a mapping of the file.
  * The @className parameter is a UTF8 encoded buffer delimited by forward slashes.
  * Answer zero on success, -1 on failure.
  *
@@ -367,6 +368,24 @@ jimageFreeResourceLocation(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourc
 I_32
 jimageGetResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, char *buffer, I_64 bufferSize, I_64 *resourceSize);
 
+/**
+ * Returns a pointer to the contents of the resource specified by given location inside a
+ * read-only mapping of the jimage file, without copying it. The pointer remains valid
+ * until the jimage file is closed. Only uncompressed resources read through the J9 jimage
+ * reader can be mapped; jimageGetResource() must be used for the others.
+ *
+ * @param [in] jimageIntf pointer to J9JImageIntf
+ * @param [in] handle handle to the jimage file
+ * @param [in] resourceLocation location of the resource
+ * @param [out] data on success points to the contents of the resource
+ *
+ * @return J9JIMAGE_NO_ERROR if *data points to the resource contents;
+ * 		   J9JIMAGE_RESOURCE_NOT_MAPPED if the resource cannot be accessed in place;
+ * 		   negative error code in other cases
+ */
+I_32
+jimageMapResource(J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, U_8 **data);
+
 /**
  * Finds the module for the given package.
  *
@@ -460,6 +479,21 @@ j9bcutil_createAndVerifyJImageLocation(J9PortLibrary *portlib, J9JImage *jimage,
 I_32
 j9bcutil_getJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, void *dataBuffer, U_64 dataBufferSize);
 
+/**
+ * Returns a pointer to an uncompressed resource inside a read-only mapping of the whole jimage file.
+ * The mapping is created on first use and released by j9bcutil_unloadJImage().
+ *
+ * @param [in] portlib pointer to J9PortLibrary
+ * @param [in] jimage pointer to J9JImage representing jimage file; must not be NULL
+ * @param [in] j9jimageLocation pointer to J9JImageLocation containing metadata of the resource
+ * @param [out] data on success points to J9JImageLocation->uncompressedSize bytes of resource data
+ *
+ * @return J9JIMAGE_NO_ERROR on success, J9JIMAGE_RESOURCE_NOT_MAPPED if the resource is compressed,
+ * 		   J9JIMAGE_MAP_FAILED if the jimage file cannot be mapped, otherwise a negative error code
+ */
+I_32
+j9bcutil_mapJImageResource(J9PortLibrary *portlib, J9JImage *jimage, J9JImageLocation *j9jimageLocation, U_8 **data);
+
 /**
  * Returns name of the resource by concatenating module, parent, base and extension strings.
  *
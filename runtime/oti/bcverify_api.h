@@ -95,6 +95,25 @@ j9bcv_freeVerificationData (J9PortLibrary * portLib, J9BytecodeVerificationData
 J9BytecodeVerificationData *
 j9bcv_initializeVerificationData (J9JavaVM* javaVM);
 
+
+/**
+* @brief Obtain a verification context for the exclusive use of currentThread.
+* @param currentThread
+* @return J9BytecodeVerificationData *, or NULL if a context could not be allocated
+*/
+J9BytecodeVerificationData *
+j9bcv_acquireVerificationContext (J9VMThread* currentThread);
+
+
+/**
+* @brief Return a context obtained from j9bcv_acquireVerificationContext.
+* @param currentThread
+* @param context
+* @return void
+*/
+void
+j9bcv_releaseVerificationContext (J9VMThread* currentThread, J9BytecodeVerificationData * context);
+
 /**
 * @brief
 * @param portLib
@@ -297,6 +297,13 @@ static const struct { \
 #define J9VTABLE_FROM_RAM_CLASS(clazz) J9VTABLE_FROM_HEADER(J9VTABLE_HEADER_FROM_RAM_CLASS(clazz))
 #define J9VTABLE_OFFSET_FROM_INDEX(index) (sizeof(J9Class) + sizeof(J9VTableHeader) + ((index) * sizeof(UDATA)))
 
+/* Macros for the interface dispatch table: iTables hashed by interface class.  Empty slots hold
+ * invalidITable and conflicting interfaces are left to a search of the iTable list.  Classes
+ * without a table of their own point at the shared, all empty invalidITableDispatch.
+ */
+#define J9_ITABLE_DISPATCH_INDEX(interfaceClass) ((((UDATA)(interfaceClass)) >> J9_REQUIRED_CLASS_SHIFT) & (J9_ITABLE_DISPATCH_SIZE - 1))
+#define J9_ITABLE_DISPATCH_PROBE(clazz, interfaceClass) (((J9Class *)(clazz))->iTableDispatch[J9_ITABLE_DISPATCH_INDEX(interfaceClass)])
+
 /* VTable constants offset */
 #define J9VTABLE_INITIAL_VIRTUAL_OFFSET (sizeof(J9Class) + offsetof(J9VTableHeader, initialVirtualMethod))
 #define J9VTABLE_INVOKE_PRIVATE_OFFSET (sizeof(J9Class) + offsetof(J9VTableHeader, invokePrivateMethod))
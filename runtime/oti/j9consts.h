@@ -333,6 +333,9 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_ENABLE_START_JITSERVER 0x40
 #define J9_EXTENDED_RUNTIME2_ENABLE_VT_ARRAY_FLATTENING 0x80
 #define J9_EXTENDED_RUNTIME2_SHOW_EXTENDED_NPEMSG 0x100
+#define J9_EXTENDED_RUNTIME2_INTERN_STACK_TRACES 0x200
+#define J9_EXTENDED_RUNTIME2_COMPRESS_ROM_CLASS_DEBUG_INFO 0x400
+#define J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING 0x800
 
 /* TODO: Define this until the JIT removes it */
 #define J9_EXTENDED_RUNTIME_ALLOW_GET_CALLER_CLASS 0
@@ -408,6 +411,13 @@ extern "C" {
  * (see J9ClassIsExemptFromValidation), a NoClassDefFoundError will be thrown.
  */
 #define J9_FINDCLASS_FLAG_NAME_IS_INVALID 0x10000
+/*
+ * The class bytes were found on the class path of the loader by findLocallyDefinedClass. They are owned
+ * by the VM (the sunClassFileBuffer, a mapping of the class path entry or the intermediate class data of
+ * a shared ROM class), and may be replaced by the next class path load, so they are parsed with the
+ * classTableMutex held.
+ */
+#define J9_FINDCLASS_FLAG_LOCALLY_DEFINED 0x20000
 
 #define J9_FINDKNOWNCLASS_FLAG_INITIALIZE 0x1
 #define J9_FINDKNOWNCLASS_FLAG_EXISTING_ONLY 0x2
@@ -59,7 +59,7 @@
 #define J9AccClassInternalPrimitiveType 0x20000
 #define J9AccClassIsContended 0x1000000
 #define J9AccClassOwnableSynchronizer 0x200000
-#define J9AccClassUnused200 0x200
+#define J9AccClassHasCompressedDebugInfo 0x200
 #define J9AccClassUnused400 0x400
 #define J9AccClassRAMArray 0x10000
 #define J9AccClassRAMShapeShift 0x10
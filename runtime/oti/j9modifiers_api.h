@@ -66,6 +66,7 @@
 #define J9ROMCLASS_ANNOTATION_REFERS_DOUBLE_SLOT_ENTRY(romClass)	_J9ROMCLASS_J9MODIFIER_IS_SET((romClass), J9AccClassAnnnotionRefersDoubleSlotEntry)
 #define J9ROMCLASS_IS_UNMODIFIABLE(romClass)	_J9ROMCLASS_J9MODIFIER_IS_SET((romClass), J9AccClassIsUnmodifiable)
 #define J9ROMCLASS_IS_RECORD(romClass)			_J9ROMCLASS_J9MODIFIER_IS_SET((romClass), J9AccRecord)
+#define J9ROMCLASS_HAS_COMPRESSED_DEBUG_INFO(romClass)	_J9ROMCLASS_J9MODIFIER_IS_SET((romClass), J9AccClassHasCompressedDebugInfo)
 
 /* 
  * Note that resolvefield ignores this flag if the cache line size cannot be determined.
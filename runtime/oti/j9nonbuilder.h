@@ -39,6 +39,10 @@
 
 #define J9VM_DLT_HISTORY_SIZE  16
 #define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_JNI_GLOBAL_REF_CACHE_SIZE  8
+#define J9VM_MONITOR_TABLE_INDEX_SIZE  4096
+#define J9VM_MONITOR_TABLE_INDEX_PROBES  4
+#define J9_ITABLE_DISPATCH_SIZE 8
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 #define CLASSNAME_INVALID			0
@@ -1049,6 +1053,12 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA corruptValue;
 	UDATA softMaxBytes;
 	UDATA otherBytes;
+	UDATA writeMutexAcquireCount;
+	UDATA writeMutexContendedCount;
+	UDATA writeMutexWaitMicros;
+	UDATA writeMutexHoldMicros;
+	UDATA cacheWriteMutexContendedCount;
+	UDATA cacheWriteMutexContendedMicros;
 	/* The fields above are stats for the top layer, and the fields below are the summary for all layers */
 	UDATA ccCount;
 	UDATA ccStartedCount;
@@ -1070,6 +1080,7 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numClasspaths;
 	UDATA numURLs;
 	UDATA numTokens;
+	UDATA numTimestampChecksAvoided;
 	UDATA numJclEntries;
 	UDATA numZipCaches;
 	UDATA numJitHints;
@@ -1081,6 +1092,8 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numObjects;
 	UDATA numStartupHints;
 	UDATA startupHintBytes;
+	UDATA verifiedClassDataBytes;
+	UDATA numVerifiedClasses;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1158,9 +1171,9 @@ typedef struct J9SharedCacheHeader {
 	UDATA unused5;
 	UDATA unused6;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
-	UDATA unused10;
+	UDATA romClassIndexSRP;
+	UDATA writeMutexContendedCount;
+	UDATA writeMutexContendedMicros;
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1200,6 +1213,7 @@ typedef struct J9SharedCacheAPI {
 	IDATA  ( *destroySharedCache)(struct J9JavaVM *vm, const char *cacheDir, const char *name, U_32 cacheType, BOOLEAN useCommandLineValues) ;
 	UDATA printStatsOptions;
 	char* methodSpecs;
+	UDATA timestampCheckInterval;
 	U_32 softMaxBytes;
 	I_32 minAOT;
 	I_32 maxAOT;
@@ -1295,6 +1309,11 @@ typedef struct J9ShrCompositeCacheCommonInfo {
 	UDATA cacheIsCorrupt;
 	UDATA stringTableStarted;
 	UDATA oldWriterCount;
+	UDATA writeMutexAcquireCount;
+	UDATA writeMutexContendedCount;
+	U_64 writeMutexWaitMicros;
+	U_64 writeMutexHoldMicros;
+	U_64 writeMutexAcquiredTime;
 } J9ShrCompositeCacheCommonInfo;
 
 #endif /* J9VM_OPT_SHARED_CLASSES */
@@ -1477,10 +1496,25 @@ typedef struct J9ObjectMonitor {
 	UDATA proDeflationCount;
 	UDATA antiDeflationCount;
 #endif /* J9VM_THR_SMART_DEFLATION */
+	UDATA spinYieldAverage;
+	UDATA spinAcquireCount;
+	UDATA spinBlockCount;
 	j9objectmonitor_t alternateLockword;
 	U_32 hash;
 } J9ObjectMonitor;
 
+/* spinYieldAverage is a fixed point value with this many fractional bits */
+#define J9_OBJECT_MONITOR_SPIN_AVERAGE_SHIFT 4
+/* each spin outcome moves spinYieldAverage 1/(2^J9_OBJECT_MONITOR_SPIN_DECAY_SHIFT) of the way to the new sample */
+#define J9_OBJECT_MONITOR_SPIN_DECAY_SHIFT 3
+/* fewest yields a monitor is allowed, so that acquisitions after a few yields can still raise a decayed average */
+#define J9_OBJECT_MONITOR_MIN_SPIN_YIELDS 4
+/* yield limit learned from spinYieldAverage: twice the yields that recently sufficed, but no fewer than J9_OBJECT_MONITOR_MIN_SPIN_YIELDS */
+#define J9_OBJECT_MONITOR_ADAPTIVE_YIELD_LIMIT(average) \
+	((((((average) * 2) >> J9_OBJECT_MONITOR_SPIN_AVERAGE_SHIFT) + 1) < J9_OBJECT_MONITOR_MIN_SPIN_YIELDS) \
+	? J9_OBJECT_MONITOR_MIN_SPIN_YIELDS \
+	: ((((average) * 2) >> J9_OBJECT_MONITOR_SPIN_AVERAGE_SHIFT) + 1))
+
 typedef struct J9ClassWalkState {
 	struct J9JavaVM* vm;
 	struct J9MemorySegment* nextSegment;
@@ -1496,6 +1530,9 @@ typedef struct J9DbgStringInternTable {
 	struct J9InternHashTableEntry* tailNode;
 	UDATA nodeCount;
 	UDATA maximumNodeCount;
+	UDATA lookupCount;
+	UDATA localHitCount;
+	UDATA sharedHitCount;
 } J9DbgStringInternTable;
 
 typedef struct J9DbgROMClassBuilder {
@@ -1510,6 +1547,8 @@ typedef struct J9DbgROMClassBuilder {
 	UDATA anonClassNameBufferSize;
 	U_8* bufferManagerBuffer;
 	struct J9DbgStringInternTable stringInternTable;
+	struct J9DbgStringInternTable* internTable;
+	struct J9DbgROMClassBuilder* nextFreeBuilder;
 } J9DbgROMClassBuilder;
 
 typedef struct J9ROMFieldWalkState {
@@ -1775,6 +1814,7 @@ typedef struct J9JImageIntf {
 	void (* jimageFreeResourceLocation)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation);
 	I_32 (* jimageGetResource)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, char *buffer, I_64 bufferSize, I_64 *resourceSize);
 	const char * (* jimagePackageToModule)(struct J9JImageIntf *jimageIntf, UDATA handle, const char *packageName);
+	I_32 (* jimageMapResource)(struct J9JImageIntf *jimageIntf, UDATA handle, UDATA resourceLocation, U_8 **data);
 } J9JImageIntf;
 
 /* @ddr_namespace: map_to_type=J9TranslationBufferSet */
@@ -1790,6 +1830,7 @@ typedef struct J9TranslationBufferSet {
 	struct J9DynamicLoadStats* dynamicLoadStats;
 	U_8* sunClassFileBuffer;
 	UDATA sunClassFileSize;
+	U_8* currentSunClassFileData;
 	UDATA currentSunClassFileSize;
 	U_8* searchFilenameBuffer;
 	UDATA searchFilenameSize;
@@ -1798,6 +1839,8 @@ typedef struct J9TranslationBufferSet {
 	U_8* classFileError;
 	UDATA classFileSize;
 	void* romClassBuilder;
+	void* romClassBuilderPool;
+	omrthread_monitor_t romClassBuilderPoolMutex;
 	IDATA  ( *findLocallyDefinedClassFunction)(struct J9VMThread * vmThread, struct J9Module * j9module, U_8 * className, U_32 classNameLength, struct J9ClassLoader * classLoader, struct J9ClassPathEntry * classPath, UDATA classPathEntryCount, UDATA options, struct J9TranslationLocalBuffer *localBuffer) ;
 	struct J9Class*  ( *internalDefineClassFunction)(struct J9VMThread* vmThread, void* className, UDATA classNameLength, U_8* classData, UDATA classDataLength, j9object_t classDataObject, struct J9ClassLoader* classLoader, j9object_t protectionDomain, UDATA options, struct J9ROMClass *existingROMClass, struct J9Class *hostClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	I_32  ( *closeZipFileFunction)(struct J9VMInterface* vmi, struct VMIZipFile* zipFile) ;
@@ -1865,6 +1908,13 @@ typedef struct J9BytecodeVerificationData {
 	struct J9PortLibrary * portLib;
 	struct J9JavaVM* javaVM;
 	BOOLEAN createdStackMap;
+	struct J9BytecodeVerificationData* nextContext;
+	struct J9BytecodeVerificationData* freeContexts;
+	omrthread_monitor_t contextPoolMutex;
+	BOOLEAN recordDependencies;
+	U_8* dependencyRecord;
+	UDATA dependencyRecordSize;
+	UDATA dependencyRecordUsed;
 } J9BytecodeVerificationData;
 
 /* @ddr_namespace: map_to_type=J9NativeLibrary */
@@ -3021,6 +3071,7 @@ typedef struct J9Class {
 	struct J9Class* arrayClass;
 	UDATA totalInstanceSize;
 	struct J9ITable* lastITable;
+	struct J9ITable** iTableDispatch;
 	UDATA* instanceDescription;
 #if defined(J9VM_GC_LEAF_BITS)
 	UDATA* instanceLeafDescription;
@@ -3094,6 +3145,7 @@ typedef struct J9ArrayClass {
 	struct J9Class* arrayClass;
 	struct J9Class* componentType;
 	struct J9ITable* lastITable;
+	struct J9ITable** iTableDispatch;
 	UDATA* instanceDescription;
 #if defined(J9VM_GC_LEAF_BITS)
 	UDATA* instanceLeafDescription;
@@ -3196,6 +3248,11 @@ typedef struct J9ClassLoader {
 	struct J9HashTable* moduleExtraInfoHashTable;
 	struct J9HashTable* classLocationHashTable;
 	struct J9HashTable* classRelationshipsHashTable;
+	struct J9HashTable* localMapCache;
+	struct J9HashTable* stackMapCache;
+	UDATA compressedDebugInfoInlineBytes;
+	UDATA compressedDebugInfoStoredBytes;
+	struct J9CompressedDebugInfo* compressedDebugInfoList;
 } J9ClassLoader;
 
 #define J9CLASSLOADER_SHARED_CLASSES_ENABLED  8
@@ -3481,6 +3538,54 @@ typedef struct J9JNIFieldID {
 	struct J9Class* declaringClass;
 } J9JNIFieldID;
 
+/* Entry in the table of interned exception walkbacks (see -XX:+InternStackTraces) */
+typedef struct J9WalkbackInternEntry {
+	UDATA hash;
+	jobject walkback; /* JNI weak global ref to the shared long[] or int[] of PCs */
+} J9WalkbackInternEntry;
+
+#define J9_WALKBACK_INTERN_TABLE_SIZE 1024
+
+/* Depth of the last walkback seen for a call site, the first PC of the walkback (see -XX:+InternStackTraces) */
+typedef struct J9WalkbackDepthEntry {
+	UDATA callSite;
+	UDATA depth;
+} J9WalkbackDepthEntry;
+
+#define J9_WALKBACK_DEPTH_CACHE_SIZE 256
+
+/* Method debug info of a ROM class held deflated outside of the ROM class (see -XX:+CompressROMClassDebugInfo) */
+typedef struct J9CompressedDebugInfo {
+	struct J9ROMClass* romClass;
+	struct J9ClassLoader* classLoader;
+	struct J9CompressedDebugInfo* loaderPrevious;
+	struct J9CompressedDebugInfo* loaderNext;
+	U_8* compressedData;
+	U_32 compressedSize;
+	U_32 uncompressedSize;
+	U_32 methodCount;
+	struct J9DecodedDebugInfo* decoded;
+} J9CompressedDebugInfo;
+
+typedef struct J9DecodedDebugInfoMethod {
+	struct J9ROMMethod* romMethod;
+	struct J9MethodDebugInfo* methodDebugInfo;
+} J9DecodedDebugInfoMethod;
+
+/* Inflated copy of a J9CompressedDebugInfo, followed in memory by its methods and the inflated data */
+typedef struct J9DecodedDebugInfo {
+	struct J9DecodedDebugInfo* lruPrevious;
+	struct J9DecodedDebugInfo* lruNext;
+	struct J9CompressedDebugInfo* compressed;
+	UDATA pinCount;
+	UDATA size;
+	J9DecodedDebugInfoMethod* methods;
+	U_8* data;
+	U_8* dataEnd;
+} J9DecodedDebugInfo;
+
+#define J9_DECODED_DEBUG_INFO_CACHE_BYTES (256 * 1024)
+
 typedef struct J9ITable {
 	struct J9Class* interfaceClass;
 	UDATA depth;
@@ -4214,6 +4319,9 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
 } J9MemoryManagerFunctions;
 
+/* Closure run by handshakeThread() while the target thread is halted */
+typedef void (*J9ThreadHandshakeFunction)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, void *userData);
+
 typedef struct J9InternalVMFunctions {
 	void* reserved0;
 	void* reserved1;
@@ -4565,6 +4673,12 @@ typedef struct J9InternalVMFunctions {
 	struct J9Class* ( *getFlattenableFieldType)(J9Class *fieldOwner, J9ROMFieldShape *field);
 	UDATA ( *getFlattenableFieldSize)(struct J9VMThread* currentThread, J9Class *fieldOwner, J9ROMFieldShape *field);
 	UDATA ( *arrayElementSize)(J9ArrayClass* arrayClass);
+	void ( *handshakeThread)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData);
+	UDATA ( *storeCompressedROMClassDebugInfo)(struct J9JavaVM *vm, struct J9ClassLoader *classLoader, struct J9ROMClass *romClass, U_8 *data, UDATA dataSize, U_32 methodCount);
+	struct J9MethodDebugInfo* ( *acquireCompressedMethodDebugInfo)(struct J9JavaVM *vm, struct J9ROMClass *romClass, struct J9ROMMethod *romMethod);
+	void ( *releaseCompressedMethodDebugInfo)(struct J9JavaVM *vm, struct J9ROMClass *romClass, struct J9MethodDebugInfo *methodDebugInfo);
+	j9object_t ( *findInternedWalkback)(struct J9VMThread *currentThread, UDATA *pcs, UDATA count, UDATA *hash);
+	void ( *internWalkback)(struct J9VMThread *currentThread, j9object_t walkback, UDATA hash);
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -4715,6 +4829,9 @@ typedef struct J9VMThread {
 	UDATA jniCriticalCopyCount;
 	UDATA jniCriticalDirectCount;
 	struct J9Pool* jniReferenceFrames;
+	UDATA monitorTableCacheHits;
+	UDATA monitorTableIndexHits;
+	UDATA monitorTableMisses;
 	U_32 ludclInlineDepth;
 	U_32 ludclBPOffset;
 #if defined(J9VM_JIT_FREE_SYSTEM_STACK_POINTER)
@@ -4769,6 +4886,10 @@ typedef struct J9VMThread {
 #endif /* OMR_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	UDATA jniGlobalRefCacheCount;
+	UDATA jniWeakGlobalRefCacheCount;
+	j9object_t* jniGlobalRefCache[J9VM_JNI_GLOBAL_REF_CACHE_SIZE];
+	j9object_t* jniWeakGlobalRefCache[J9VM_JNI_GLOBAL_REF_CACHE_SIZE];
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -4911,6 +5032,8 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t exclusiveAccessMutex;
 	struct J9Pool* jniGlobalReferences;
 	struct J9Pool* jniWeakGlobalReferences;
+	struct J9WalkbackInternEntry* walkbackInternTable;
+	struct J9WalkbackDepthEntry* walkbackDepthCache;
 	omrthread_monitor_t vmThreadListMutex;
 	j9object_t selectorHashTable;
 	struct J9Pool* classLoaderBlocks;
@@ -5003,6 +5126,7 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveTryEnterSpinning;
 	UDATA thrDeflationPolicy;
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
@@ -5043,6 +5167,11 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t monitorTableMutex;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
+	struct J9ObjectMonitor* volatile * monitorTableIndex;
+	UDATA monitorTableIndexStale;
+	UDATA monitorTableCacheHits;
+	UDATA monitorTableIndexHits;
+	UDATA monitorTableMisses;
 	UDATA thrStaggerStep;
 	UDATA thrStaggerMax;
 	UDATA thrStagger;
@@ -5143,6 +5272,14 @@ typedef struct J9JavaVM {
 	U_8* mapMemoryResultsBuffer;
 	UDATA mapMemoryBufferSize;
 	omrthread_monitor_t mapMemoryBufferMutex;
+	omrthread_monitor_t mapCacheMutex;
+	UDATA mapCacheHits;
+	UDATA mapCacheMisses;
+	omrthread_monitor_t compressedDebugInfoMutex;
+	struct J9HashTable* compressedDebugInfoTable;
+	struct J9DecodedDebugInfo* decodedDebugInfoHead;
+	struct J9DecodedDebugInfo* decodedDebugInfoTail;
+	UDATA decodedDebugInfoBytes;
 	omrthread_monitor_t jclCacheMutex;
 	UDATA arrayletLeafSize;
 	UDATA arrayletLeafLogSize;
@@ -5216,6 +5353,8 @@ typedef struct J9JavaVM {
 	UDATA addModulesCount;
 	UDATA safePointState;
 	UDATA safePointResponseCount;
+	UDATA globalSafePointCount;
+	UDATA targetedHandshakeCount;
 	struct J9VMRuntimeStateListener vmRuntimeStateListener;
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
 #if defined(J9UNIX) || defined(AIXPPC)
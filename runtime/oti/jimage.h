@@ -100,6 +100,7 @@ typedef struct J9JImage {
 	U_64 fileLength;
 	struct J9JImageHeader *j9jimageHeader;
 	J9MmapHandle *jimageMmap;
+	J9MmapHandle *resourcesMmap;
 } J9JImage;
 
 typedef struct DecompressorInfo {
@@ -63,6 +63,7 @@
 #define J9JIMAGE_MODULE_METAINFO_LOOKUP_FAILED -24
 #define J9JIMAGE_MODULE_METAINFO_RESOURCE_FAILED -25
 #define J9JIMAGE_RESOURCE_TRUNCATED -26
+#define J9JIMAGE_RESOURCE_NOT_MAPPED -27
 
 /* Invalid jimage structure error(s) -31 to -40 */
 #define J9JIMAGE_INVALID_HEADER -31
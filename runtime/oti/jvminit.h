@@ -315,6 +315,12 @@ enum INIT_STAGE {
 #define VMOPT_XNORTSJ "-Xnortsj"
 #define VMOPT_XXNOSTACKTRACEINTHROWABLE "-XX:-StackTraceInThrowable"
 #define VMOPT_XXSTACKTRACEINTHROWABLE "-XX:+StackTraceInThrowable"
+#define VMOPT_XXNOINTERNSTACKTRACES "-XX:-InternStackTraces"
+#define VMOPT_XXINTERNSTACKTRACES "-XX:+InternStackTraces"
+#define VMOPT_XXNOCOMPRESSROMCLASSDEBUGINFO "-XX:-CompressROMClassDebugInfo"
+#define VMOPT_XXCOMPRESSROMCLASSDEBUGINFO "-XX:+CompressROMClassDebugInfo"
+#define VMOPT_XXNOMAPCLASSFILEDATA "-XX:-MapClassFileData"
+#define VMOPT_XXMAPCLASSFILEDATA "-XX:+MapClassFileData"
 #define VMOPT_XXNOPAGEALIGNDIRECTMEMORY "-XX:-PageAlignDirectMemory"
 #define VMOPT_XXPAGEALIGNDIRECTMEMORY   "-XX:+PageAlignDirectMemory"
 #define VMOPT_XXVMLOCKCLASSLOADERENABLE "-XX:+VMLockClassLoader"
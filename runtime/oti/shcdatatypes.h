@@ -70,8 +70,9 @@ extern "C" {
 #define TYPE_CACHELET 10
 #define TYPE_ATTACHED_DATA 11
 #define TYPE_PREREQ_CACHE 12
+#define TYPE_ROMCLASS_INDEX 13
 /* This macro should have same value as the last valid macro defining a type of cache data */
-#define MAX_DATA_TYPES 12
+#define MAX_DATA_TYPES 13
 
 typedef struct ShcItemHdr {
 	U_32 itemLen; 		/* lower bit set means item is stale */
@@ -158,6 +159,27 @@ typedef struct OrphanWrapper {
 	J9ShrOffset romClassOffset;
 } OrphanWrapper;
 
+/* Persisted index of the ROMClass, scoped ROMClass and orphan items in a cache, keyed by class name.
+ * The slots are an open addressed table with linear probing, so the index can be searched in place by any JVM.
+ * Every such item at or above boundaryOffset is in the index. Offsets are from the start of the cache header.
+ */
+typedef struct ROMClassIndexSlot {
+	U_32 itemOffset;	/* 0 if the slot is free */
+	U_32 nameHash;
+} ROMClassIndexSlot;
+
+typedef struct ROMClassIndexWrapper {
+	U_32 version;
+	U_32 slotCount;		/* always a power of 2 */
+	U_32 entryCount;
+	U_32 boundaryOffset;
+	U_32 crashCntr;		/* low 32 bits of the crashCntr of the cache header when the index was created */
+} ROMClassIndexWrapper;
+
+#define ROMCLASS_INDEX_VERSION 1
+#define RCIWSLOTS(rciw) ((ROMClassIndexSlot*)(((U_8*)(rciw)) + sizeof(ROMClassIndexWrapper)))
+#define RCIWLEN(slotCount) (sizeof(ROMClassIndexWrapper) + ((slotCount) * sizeof(ROMClassIndexSlot)))
+
 typedef struct CompiledMethodWrapper {
 	J9ShrOffset romMethodOffset;
 	U_32 dataLength;
@@ -37,6 +37,7 @@
 
 #define MAP_MEMORY_RESULTS_BUFFER_SIZE 8192
 #define MAP_MEMORY_DEFAULT (180 * 1024)
+#define MAP_CACHE_MAX_ENTRIES 8192
 
 #ifdef __cplusplus
 extern "C" {
@@ -196,6 +197,38 @@ j9stackmap_StackBitsForPC(J9PortLibrary * portLib, UDATA pc, J9ROMClass * romCla
 		UDATA * (* getBuffer) (void * userData), 
 		void (* releaseBuffer) (void * userData));
 
+
+/* ---------------- mapcache.c ---------------- */
+
+/**
+* @brief Compute the local map at pc, using the map cached in classLoader when there is one.
+* @param vm
+* @param classLoader the loader owning the ROM memory of romClass, or NULL to bypass the cache
+* @param romClass
+* @param romMethod
+* @param pc
+* @param resultArrayBase
+* @param slotCount the number of locals being mapped
+* @return IDATA
+*/
+IDATA
+j9mapcache_LocalBitsForPC(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount);
+
+
+/**
+* @brief Compute the stack map at pc, using the map cached in classLoader when there is one.
+* @param vm
+* @param classLoader the loader owning the ROM memory of romClass, or NULL to bypass the cache
+* @param romClass
+* @param romMethod
+* @param pc
+* @param resultArrayBase
+* @param slotCount the number of pending stack slots being mapped
+* @return IDATA
+*/
+IDATA
+j9mapcache_StackBitsForPC(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1493,6 +1493,27 @@ getLineNumberTable(J9MethodDebugInfo *methodInfo);
 J9MethodDebugInfo *
 getMethodDebugInfoForROMClass(J9JavaVM *vm, J9Method *method);
 
+/**
+* @brief Get the debug info of a ROM method, including debug info which is stored compressed
+* outside of the ROM class. The result must be passed to releaseMethodDebugInfo when done.
+* @param *vm
+* @param *romClass the ROM class of the method
+* @param *romMethod the original ROM method
+* @return J9MethodDebugInfo *, or NULL if the method has no debug info
+*/
+J9MethodDebugInfo *
+getMethodDebugInfoForROMMethod(J9JavaVM *vm, J9ROMClass *romClass, J9ROMMethod *romMethod);
+
+/**
+* @brief Release debug info returned by getMethodDebugInfoForROMClass or getMethodDebugInfoForROMMethod.
+* @param *vm
+* @param *romClass the ROM class of the method
+* @param *methodInfo the debug info, may be NULL
+* @return void
+*/
+void
+releaseMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9MethodDebugInfo *methodInfo);
+
 
 /**
 * @brief
@@ -1808,6 +1829,28 @@ UDATA
 computeHashForUTF8(const U_8 * data, UDATA length);
 
 
+/* ---------------- utf8scan.c ---------------- */
+
+/**
+ * @brief Count the leading single byte (0x01 to 0x7F) characters of a UTF8 string
+ * @param data points to raw UTF8 bytes
+ * @param length is the number of bytes
+ * @return UDATA
+ */
+UDATA
+countUTF8SingleByteChars(const U_8 *data, UDATA length);
+
+/**
+ * @brief Continue a String.hashCode() style hash over bytes which are each one character
+ * @param hash is the hash so far, or the seed
+ * @param data points to the bytes
+ * @param length is the number of bytes
+ * @return UDATA
+ */
+UDATA
+computeHashForBytes(UDATA hash, const U_8 *data, UDATA length);
+
+
 /* ---------------- wildcard.c ---------------- */
 
 /**
@@ -2081,6 +2124,16 @@ typedef struct J9JVMTIHCRJitEventData {
 void
 jitEventFree(J9JavaVM * vm, J9JVMTIHCRJitEventData * eventData);
 
+/**
+ * @brief Fill the interface dispatch table of a class from its iTable list.
+ * The first iTable to hash to each slot wins; later conflicting iTables are only found by searching the list.
+ * Classes sharing invalidITableDispatch are left untouched.
+ * @param clazz the class to initialize
+ * @return void
+ */
+void
+initializeITableDispatch(J9Class * clazz);
+
 void
 fixStaticRefs(J9VMThread * currentThread, J9HashTable * classPairs, UDATA extensionsUsed);
 
@@ -837,6 +837,32 @@ initializeHeapOOMMessage(J9VMThread *currentThread);
 void  
 setIllegalAccessErrorFinalFieldSet(J9VMThread *currentThread, UDATA isStatic, J9ROMClass *romClass, J9ROMFieldShape *field, J9ROMMethod *romMethod);
 
+/**
+* @brief
+* Look up a walkback array with the given PCs in the table of interned walkbacks (-XX:+InternStackTraces).
+* The caller must have VM access and vm->walkbackInternTable must be non-NULL.
+* @param currentThread
+* @param pcs the PCs cached by the stack walk
+* @param count the number of PCs
+* @param hash returns the hash of the PCs, to be passed to internWalkback
+* @return the shared walkback array, or NULL if none matches
+*/
+j9object_t
+findInternedWalkback(J9VMThread *currentThread, UDATA *pcs, UDATA count, UDATA *hash);
+
+/**
+* @brief
+* Record a newly filled walkback array in the table of interned walkbacks, replacing any previous entry
+* for the same hash bucket.  Walkbacks are only interned once their call site has been seen twice in a
+* row with the same depth (see vm->walkbackDepthCache).  The array must not be modified after this call.
+* @param currentThread
+* @param walkback the walkback array
+* @param hash the hash returned by findInternedWalkback
+* @return void
+*/
+void
+internWalkback(J9VMThread *currentThread, j9object_t walkback, UDATA hash);
+
 /**
 * @brief
 * @param vmThread
@@ -1158,6 +1184,15 @@ void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak);
 
 
+/**
+* @brief Return the JNI global ref slots cached by a thread to the VM-wide pools
+* @param *vmThread
+* @return void
+*/
+void
+flushJNIGlobalRefCaches(J9VMThread *vmThread);
+
+
 /**
 * @brief
 * @param *env
@@ -1699,6 +1734,50 @@ isJITServerEnabled(J9JavaVM *vm);
 
 #endif /* J9VM_OPT_JITSERVER */
 
+/* ---------------- romdebuginfo.c ---------------- */
+
+/**
+* @brief
+* Deflate the method debug info which was left out of a ROM class and keep it until the class loader
+* is unloaded (-XX:+CompressROMClassDebugInfo).  The data is a sequence of records, one per method,
+* each holding the U_32 index of the ROM method followed by its J9MethodDebugInfo as it would have
+* been laid down inline in the ROM method.
+* @param vm
+* @param classLoader the class loader which owns the ROM class
+* @param romClass the ROM class, which has J9AccClassHasCompressedDebugInfo set
+* @param data the method debug info records
+* @param dataSize the size in bytes of the records
+* @param methodCount the number of records
+* @return 0 on success, non-zero if the memory could not be allocated
+*/
+UDATA
+storeCompressedROMClassDebugInfo(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, U_8 *data, UDATA dataSize, U_32 methodCount);
+
+/**
+* @brief
+* Find the method debug info of a ROM method whose debug info was compressed, inflating the debug info
+* of its class if necessary.  The returned debug info remains valid until it is passed to
+* releaseCompressedMethodDebugInfo.
+* @param vm
+* @param romClass the ROM class of the method
+* @param romMethod the original ROM method
+* @return the method debug info, or NULL if the method has none
+*/
+J9MethodDebugInfo *
+acquireCompressedMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9ROMMethod *romMethod);
+
+/**
+* @brief
+* Release method debug info returned by acquireCompressedMethodDebugInfo.  Debug info which was
+* not inflated, such as debug info stored inline in a ROM method, is ignored.
+* @param vm
+* @param romClass the ROM class of the method
+* @param methodDebugInfo the method debug info
+* @return void
+*/
+void
+releaseCompressedMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9MethodDebugInfo *methodDebugInfo);
+
 /* ---------------- romutil.c ---------------- */
 
 /**
@@ -2097,6 +2176,17 @@ void
 cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor* objectMonitor);
 
 
+/**
+* @brief Empty the lock-free monitor table index and stop using it until
+*        objectMonitorDestroyComplete is called
+* @param vm  J9JavaVM
+* @return void
+* @pre the caller must be the GC, with all mutator threads stopped
+*/
+void
+invalidateMonitorTableIndex(J9JavaVM* vm);
+
+
 /* ---------------- PackageIDHashTable.c ---------------- */
 
 /**
@@ -3348,6 +3438,21 @@ void
 resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread);
 
 
+/**
+* @brief Run a function on behalf of a single thread once it has stopped at its next safe point.
+* Only the target thread is halted; the rest of the VM keeps running.
+* @param currentThread the requesting thread, which must have VM access
+* @param targetThread the thread to stop, which may be currentThread
+* @param function the function to run while targetThread is halted
+* @param userData passed through to function
+* @return void
+*
+* VM access may be released and reacquired by this call - direct object pointers must not be held across it.
+*/
+void
+handshakeThread(J9VMThread * currentThread, J9VMThread * targetThread, J9ThreadHandshakeFunction function, void * userData);
+
+
 /**
 * @brief
 * @param vmThread
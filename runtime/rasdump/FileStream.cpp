@@ -25,11 +25,26 @@
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
 
+#ifdef AIXPPC	/* hack for zlib/AIX problem */
+#define STDC
+#endif
+
+#include "zlib.h"
+
+/* Size of each of the uncompressed and compressed data buffers used for gzip output */
+#define FILESTREAM_COMPRESSION_BUFFER_SIZE (64 * 1024)
+
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_ZStream(NULL),
+	_Buffer(NULL),
+	_BufferPos(0),
+	_BytesAccepted(0),
+	_BytesWritten(0),
+	_CompressionNanos(0)
 {
 	/* Nothing to do */
 }
@@ -47,6 +62,39 @@ FileStream::open(const char* fileName)
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+		_BytesAccepted = 0;
+		_BytesWritten = 0;
+		_CompressionNanos = 0;
+	}
+}
+
+/* Method for opening the file with its contents written in gzip format */
+void
+FileStream::openCompressed(const char* fileName)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	open(fileName);
+
+	if (_FileHandle != -1) {
+		_ZStream = (struct z_stream_s*)j9mem_allocate_memory(sizeof(z_stream), OMRMEM_CATEGORY_VM);
+		_Buffer = (char*)j9mem_allocate_memory(2 * FILESTREAM_COMPRESSION_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+		_BufferPos = 0;
+
+		if ((NULL != _ZStream) && (NULL != _Buffer)) {
+			memset(_ZStream, 0, sizeof(z_stream));
+
+			/* Favour speed over ratio, the point is to get large heaps onto disk sooner. Adding 16 to the window bits selects the gzip wrapper. */
+			if (Z_OK == deflateInit2(_ZStream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY)) {
+				return;
+			}
+		}
+
+		j9mem_free_memory(_ZStream);
+		j9mem_free_memory(_Buffer);
+		_ZStream = NULL;
+		_Buffer = NULL;
+		_Error = -1;
 	}
 }
 
@@ -54,9 +102,19 @@ FileStream::open(const char* fileName)
 void 
 FileStream::close(void)
 {
+	if (_ZStream != NULL) {
+		endCompression();
+	}
+
 	if (_FileHandle != -1) {
-		j9cached_file_sync(_PortLibrary, _FileHandle);
-		j9cached_file_close(_PortLibrary, _FileHandle);
+		/* Flushing the cached buffers at close is the last write, so its failure is an error like any other */
+		IDATA rc = j9cached_file_sync(_PortLibrary, _FileHandle);
+		if (0 != j9cached_file_close(_PortLibrary, _FileHandle)) {
+			rc = -1;
+		}
+		if ((0 != rc) && ! _Error) {
+			_Error = rc;
+		}
 	}
 
 	_FileHandle = -1;	
@@ -73,19 +131,113 @@ bool FileStream::hasError(void) const
 	return _Error != 0;
 }
 
+/* Methods for getting the amount of data handled and the time spent compressing it */
+U_64 FileStream::bytesAccepted(void) const
+{
+	return _BytesAccepted;
+}
+
+U_64 FileStream::bytesWritten(void) const
+{
+	return _BytesWritten;
+}
+
+U_64 FileStream::compressionNanos(void) const
+{
+	return _CompressionNanos;
+}
+
 /* Method for writing characters described by a pointer and a length to the file*/
 void
 FileStream::writeCharacters(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
-		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+		_BytesAccepted += length;
 
-		if (rc != length) {
-			_Error = rc;
+		if (_ZStream == NULL) {
+			writeFile(data, length);
+			return;
+		}
+
+		/* Gather the data so that zlib is handed large blocks rather than individual fields */
+		while (length > 0 && ! _Error) {
+			IDATA count = FILESTREAM_COMPRESSION_BUFFER_SIZE - _BufferPos;
+
+			if (count > length) {
+				count = length;
+			}
+			memcpy(_Buffer + _BufferPos, data, count);
+			_BufferPos += count;
+			data += count;
+			length -= count;
+
+			if (_BufferPos == FILESTREAM_COMPRESSION_BUFFER_SIZE) {
+				compress(Z_NO_FLUSH);
+			}
 		}
 	}
 }
 
+/* Method for writing data to the file as is */
+void
+FileStream::writeFile(const char* data, IDATA length)
+{
+	IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+
+	if (rc != length) {
+		_Error = rc;
+	} else {
+		_BytesWritten += length;
+	}
+}
+
+/* Method for compressing the gathered data and writing the output to the file */
+void
+FileStream::compress(int flush)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	char* output = _Buffer + FILESTREAM_COMPRESSION_BUFFER_SIZE;
+
+	_ZStream->next_in = (Bytef*)_Buffer;
+	_ZStream->avail_in = (uInt)_BufferPos;
+
+	do {
+		_ZStream->next_out = (Bytef*)output;
+		_ZStream->avail_out = FILESTREAM_COMPRESSION_BUFFER_SIZE;
+
+		I_64 start = j9time_nano_time();
+		int rc = deflate(_ZStream, flush);
+		_CompressionNanos += (U_64)(j9time_nano_time() - start);
+
+		if (rc == Z_STREAM_ERROR) {
+			_Error = -1;
+			break;
+		}
+
+		writeFile(output, FILESTREAM_COMPRESSION_BUFFER_SIZE - _ZStream->avail_out);
+	} while (_ZStream->avail_out == 0 && ! _Error);
+
+	_BufferPos = 0;
+}
+
+/* Method for completing the gzip output and releasing the compressor */
+void
+FileStream::endCompression(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_FileHandle != -1 && ! _Error) {
+		compress(Z_FINISH);
+	}
+
+	deflateEnd(_ZStream);
+	j9mem_free_memory(_ZStream);
+	j9mem_free_memory(_Buffer);
+	_ZStream = NULL;
+	_Buffer = NULL;
+	_BufferPos = 0;
+}
+
 void
 FileStream::writeCharacters(const char* data)
 {
@@ -25,6 +25,9 @@
 /* Includes */
 #include "j9port.h"
 
+/* Declarations to avoid inclusions */
+struct z_stream_s;
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing to a file                                                                    */
@@ -42,6 +45,9 @@ public :
 	/* Method for opening the file */
 	void open(const char* fileName);
 
+	/* Method for opening the file with its contents written in gzip format */
+	void openCompressed(const char* fileName);
+
 	/* Method for closing the file */
 	void close(void);
 
@@ -49,6 +55,11 @@ public :
 	bool isOpen(void) const;
 	bool hasError(void) const;
 
+	/* Methods for getting the amount of data handled and the time spent compressing it */
+	U_64 bytesAccepted(void) const;
+	U_64 bytesWritten(void) const;
+	U_64 compressionNanos(void) const;
+
 	/* Methods for writing data to the file */
 	void writeCharacters (const char* data, IDATA length);
 	void writeCharacters (const char* data);
@@ -59,11 +70,22 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Methods for the gzip output */
+	void writeFile(const char* data, IDATA length);
+	void compress(int flush);
+	void endCompression(void);
+
 protected :
 	/* Declared data */
-	J9PortLibrary* _PortLibrary;
-	IDATA          _FileHandle;
-	IDATA          _Error;
+	J9PortLibrary*     _PortLibrary;
+	IDATA              _FileHandle;
+	IDATA              _Error;
+	struct z_stream_s* _ZStream;
+	char*              _Buffer;
+	IDATA              _BufferPos;
+	U_64               _BytesAccepted;
+	U_64               _BytesWritten;
+	U_64               _CompressionNanos;
 };
 
 #endif
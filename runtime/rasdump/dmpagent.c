@@ -1855,7 +1855,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 					"        [+<name>...]     (see -Xdump:request)\n");
 
 				if (strcmp(spec->name, "heap") == 0) {
-					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf(PORTLIB, "\n  opts=PHD[+GZIP]|CLASSIC\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -52,6 +52,10 @@ static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback
 #define allClassesEndDo(vm, state) \
 	vm->internalVMFunctions->allClassesEndDo(state)
 
+/* Objects written between checks on whether a progress message is due, and the time between progress messages */
+#define HEAPDUMP_PROGRESS_CHECK_OBJECTS 0x10000
+#define HEAPDUMP_PROGRESS_INTERVAL_MILLIS 10000
+
 /* Function prototypes for performance measurement 
 void startTimer();
 void stopTimer();
@@ -844,6 +848,11 @@ private :
 
 	/* Internal methods */
 	void             openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDesriptor);
+	void             openOutputStream(const char* fileName);
+	void             appendCompressedSuffix(CharacterString& fileName);
+	void             startStatistics(void);
+	void             reportProgress(void);
+	void             reportStatistics(void);
 	void             writeDumpFileHeader(void);
 	void             writeDumpFileTrailer(void);
 	void             writeFullVersionRecord(void);
@@ -873,6 +882,12 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	bool              _Compress;
+	UDATA             _ObjectCount;
+	UDATA             _ClassCount;
+	I_64              _StartMillis;
+	I_64              _ClassWalkStartMillis;
+	I_64              _LastProgressMillis;
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -1124,9 +1139,16 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Compress((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "GZIP") != 0)),
+	_ObjectCount(0),
+	_ClassCount(0),
+	_StartMillis(0),
+	_ClassWalkStartMillis(0),
+	_LastProgressMillis(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	CharacterString outputFileName(PORTLIB);
 
 	/* If a binary heap dump hasn't been requested there's nothing to do */
 	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "PHD") == 0)) {
@@ -1135,6 +1157,9 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	
 	/* Remember the file name */
 	_FileName += fileName;
+	outputFileName += fileName;
+	appendCompressedSuffix(outputFileName);
+	fileName = outputFileName.data();
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
@@ -1142,13 +1167,10 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		openOutputStream(fileName);
 	
-		/* Performance measuring code 
-		startTimer();
-		*/
-
 		/* Start writing the file */
+		startStatistics();
 		writeDumpFileHeader();
 	}
 
@@ -1162,15 +1184,14 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 			writeDumpFileTrailer();
 		}
 
-		/* Performance measuring code 
-		stopTimer();
-		*/
-
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
 
-		/* Close the file */
+		/* Close the file, which writes out the remaining compressed data and the trailer */
 		_OutputStream.close();
+		if (! _Error) {
+			checkForIOError();
+		}
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
@@ -1178,6 +1199,7 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 			if (_FileMode) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				reportStatistics();
 			} else {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
@@ -1218,6 +1240,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		fileName += spaceDescriptor->name;
 		fileName.appendAsCharacters(spaceDescriptor->id, 16);
 		fileName.append(_FileName, position + 3);
+		appendCompressedSuffix(fileName);
 
 		/* Write a message to standard error saying we are about to write a dump file */
 		reportDumpRequest(PORTLIB, _Context,"Heap", fileName.data());
@@ -1227,9 +1250,10 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		openOutputStream(fileName.data());
 
 		/* Start writing the file */
+		startStatistics();
 		writeDumpFileHeader();
 	}
 
@@ -1252,8 +1276,11 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		/* Record the status of the operation */
 		_FileMode = _FileMode || _OutputStream.isOpen();
 
-		/* Close the file */
+		/* Close the file, which writes out the remaining compressed data and the trailer */
 		_OutputStream.close();
+		if (! _Error) {
+			checkForIOError();
+		}
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
@@ -1261,6 +1288,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 			if (_FileMode) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName.data());
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName.data());
+				reportStatistics();
 			} else {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName.data());
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName.data());
@@ -1333,13 +1361,18 @@ BinaryHeapDumpWriter::writeDumpFileHeader(void)
 void
 BinaryHeapDumpWriter::writeDumpFileTrailer(void)
 {
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
 	J9ClassWalkState state;
 	J9Class *clazz;
 	
+	/* The heap walk is complete */
+	_ClassWalkStartMillis = j9time_current_time_millis();
+
 	/* Iterate through the classes writing them */
 	clazz = allClassesStartDo(_VirtualMachine, &state, NULL);
 	while (clazz) {
 		writeClassRecord(clazz);
+		_ClassCount += 1;
 		if (_Error) {
 			/* Finish the class iteration to release any locks. */
 			allClassesEndDo(_VirtualMachine, &state);
@@ -1403,11 +1436,18 @@ BinaryHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDesc
 	/* Handle class, array and normal objects separately */
 	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
 		/* Do nothing - heap classes are handled in a separate walk */
-	} else if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
-		writeArrayObjectRecord(objectDescriptor);
 	} else {
-		writeNormalObjectRecord(objectDescriptor);
-	}	
+		if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
+			writeArrayObjectRecord(objectDescriptor);
+		} else {
+			writeNormalObjectRecord(objectDescriptor);
+		}
+
+		_ObjectCount += 1;
+		if (0 == (_ObjectCount % HEAPDUMP_PROGRESS_CHECK_OBJECTS)) {
+			reportProgress();
+		}
+	}
 }
 
 /**************************************************************************************************/
@@ -2391,6 +2431,98 @@ BinaryHeapDumpWriter::checkForIOError(void)
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::openOutputStream() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::openOutputStream(const char* fileName)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_Compress) {
+		_OutputStream.openCompressed(fileName);
+
+		if (_OutputStream.hasError()) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_NO_COMPRESS, fileName);
+			_Error = true;
+		}
+	} else {
+		_OutputStream.open(fileName);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::appendCompressedSuffix() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::appendCompressedSuffix(CharacterString& fileName)
+{
+	/* Gzip output gets a .gz suffix unless the label already supplies one */
+	if (_Compress) {
+		UDATA length = fileName.length();
+
+		if ((length < 3) || (strcmp(fileName.data() + length - 3, ".gz") != 0)) {
+			fileName += ".gz";
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::startStatistics() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::startStatistics(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	_ObjectCount = 0;
+	_ClassCount = 0;
+	_StartMillis = j9time_current_time_millis();
+	_ClassWalkStartMillis = _StartMillis;
+	_LastProgressMillis = _StartMillis;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::reportProgress() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::reportProgress(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	I_64 now = j9time_current_time_millis();
+
+	if ((now - _LastProgressMillis) >= HEAPDUMP_PROGRESS_INTERVAL_MILLIS) {
+		_LastProgressMillis = now;
+		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_HEAP_DUMP_PROGRESS,
+			_ObjectCount, (U_64)(now - _StartMillis), _OutputStream.bytesWritten());
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::reportStatistics() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::reportStatistics(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	I_64 now = j9time_current_time_millis();
+
+	j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_HEAP_DUMP_STATISTICS,
+		_ObjectCount, _ClassCount, (U_64)(now - _StartMillis),
+		(U_64)(_ClassWalkStartMillis - _StartMillis), (U_64)(now - _ClassWalkStartMillis),
+		_OutputStream.compressionNanos() / 1000000, _OutputStream.bytesAccepted(), _OutputStream.bytesWritten());
+}
+
 void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
@@ -1770,6 +1770,25 @@ JavaCoreDumpWriter::writeMonitorSection(void)
 
 	_OutputStream.writeInteger(getObjectMonitorCount(_VirtualMachine), "%zu");
 	_OutputStream.writeCharacters("\n");
+
+	/* Monitor table lookups by where they were satisfied, including those of exited threads */
+	UDATA cacheHits = _VirtualMachine->monitorTableCacheHits;
+	UDATA indexHits = _VirtualMachine->monitorTableIndexHits;
+	UDATA misses = _VirtualMachine->monitorTableMisses;
+	J9VMThread *lookupThread = J9_LINKED_LIST_START_DO(_VirtualMachine->mainThread);
+	while (NULL != lookupThread) {
+		cacheHits += lookupThread->monitorTableCacheHits;
+		indexHits += lookupThread->monitorTableIndexHits;
+		misses += lookupThread->monitorTableMisses;
+		lookupThread = J9_LINKED_LIST_NEXT_DO(_VirtualMachine->mainThread, lookupThread);
+	}
+	_OutputStream.writeCharacters("2LKPOOLLOOKUPS   Monitor table lookups: thread cache hits ");
+	_OutputStream.writeInteger(cacheHits, "%zu");
+	_OutputStream.writeCharacters(", index hits ");
+	_OutputStream.writeInteger(indexHits, "%zu");
+	_OutputStream.writeCharacters(", misses ");
+	_OutputStream.writeInteger(misses, "%zu");
+	_OutputStream.writeCharacters("\n");
 	_OutputStream.writeCharacters("NULL           \n");
 
 	/* Stack-allocate a store for blocked thread information, to save having to re-walk the threads. First
@@ -1901,6 +1920,18 @@ JavaCoreDumpWriter::writeThreadSection(void)
 		"2XMPOOLDAEMON      Current total number of live daemon threads: ");
 	_OutputStream.writeInteger(_VirtualMachine->daemonThreadCount, "%i");
 	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters(
+		"2XMSAFEPOINTS      Global safepoints: ");
+	_OutputStream.writeInteger(_VirtualMachine->globalSafePointCount, "%zu");
+	_OutputStream.writeCharacters(", targeted thread handshakes: ");
+	_OutputStream.writeInteger(_VirtualMachine->targetedHandshakeCount, "%zu");
+	_OutputStream.writeCharacters("\n");
+	_OutputStream.writeCharacters(
+		"2XMSTACKMAPS       Interpreter stack map cache hits: ");
+	_OutputStream.writeInteger(_VirtualMachine->mapCacheHits, "%zu");
+	_OutputStream.writeCharacters(", misses: ");
+	_OutputStream.writeInteger(_VirtualMachine->mapCacheMisses, "%zu");
+	_OutputStream.writeCharacters("\n");
 
 #if !defined(OSX)
 	/* if thread preempt is enabled, and we have the lock, then collect the native stacks */
@@ -2537,6 +2568,25 @@ JavaCoreDumpWriter::writeClassSection(void)
 
 	pool_do(_VirtualMachine->classLoaderBlocks, writeClassesCallBack, this);
 
+	/* ROM class UTF8 intern table lookups, by the table they were satisfied from */
+	J9TranslationBufferSet *dynamicLoadBuffers = _VirtualMachine->dynamicLoadBuffers;
+	if ((NULL != dynamicLoadBuffers) && (NULL != dynamicLoadBuffers->romClassBuilder)) {
+		J9DbgStringInternTable *internTable = &((J9DbgROMClassBuilder *)dynamicLoadBuffers->romClassBuilder)->stringInternTable;
+		if (NULL != internTable->internHashTable) {
+			_OutputStream.writeCharacters("1CLTEXTINTERN  \tROM class string intern table: nodes ");
+			_OutputStream.writeInteger(internTable->nodeCount, "%zu");
+			_OutputStream.writeCharacters(" of ");
+			_OutputStream.writeInteger(internTable->maximumNodeCount, "%zu");
+			_OutputStream.writeCharacters(", lookups ");
+			_OutputStream.writeInteger(internTable->lookupCount, "%zu");
+			_OutputStream.writeCharacters(", local hits ");
+			_OutputStream.writeInteger(internTable->localHitCount, "%zu");
+			_OutputStream.writeCharacters(", shared hits ");
+			_OutputStream.writeInteger(internTable->sharedHitCount, "%zu");
+			_OutputStream.writeCharacters("\n");
+		}
+	}
+
 	/* Write the section trailer */
 	_OutputStream.writeCharacters(
 		"NULL           ------------------------------------------------------------------------\n"
@@ -3012,6 +3062,36 @@ JavaCoreDumpWriter::writeSharedClassSectionTopLayerStatsHelper(J9SharedClassJava
 	);
 	_OutputStream.writeInteger(javacoreData->readWriteBytes, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWMA            Write mutex acquisitions                  = "
+	);
+	_OutputStream.writeInteger(javacoreData->writeMutexAcquireCount, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWMC            Write mutex contended acquisitions        = "
+	);
+	_OutputStream.writeInteger(javacoreData->writeMutexContendedCount, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWMW            Write mutex wait time (usec)              = "
+	);
+	_OutputStream.writeInteger(javacoreData->writeMutexWaitMicros, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWMH            Write mutex hold time (usec)              = "
+	);
+	_OutputStream.writeInteger(javacoreData->writeMutexHoldMicros, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWCC            Cache write mutex contended acquisitions  = "
+	);
+	_OutputStream.writeInteger(javacoreData->cacheWriteMutexContendedCount, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTWCW            Cache write mutex contended wait (usec)   = "
+	);
+	_OutputStream.writeInteger(javacoreData->cacheWriteMutexContendedMicros, "%zu");
+
 	if (NO_CORRUPTION != javacoreData->corruptionCode) {
 		_OutputStream.writeCharacters(
 			"\n2SCLTEXTCOC            Corruption Code                           = "
@@ -3154,6 +3234,11 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->jitProfileDataBytes, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTVCB            Verified class bytes                      = "
+	);
+	_OutputStream.writeInteger(javacoreData->verifiedClassDataBytes, "%zu");
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTNOB            Java Object bytes                         = "
 	);
@@ -3215,6 +3300,11 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->numJitProfiles, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNVC            Number Verified Classes                   = "
+	);
+	_OutputStream.writeInteger(javacoreData->numVerifiedClasses, "%zu");
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTNCP            Number Classpaths                         = "
 	);
@@ -3230,6 +3320,11 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->numTokens, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNTC            Number Timestamp Checks Avoided           = "
+	);
+	_OutputStream.writeInteger(javacoreData->numTimestampChecksAvoided, "%zu");
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTNOJ            Number Java Objects                       = "
 	);
@@ -4935,6 +5030,15 @@ JavaCoreDumpWriter::writeLoader(J9ClassLoader* classLoader)
 
 	_OutputStream.writeCharacters("\n");
 
+	/* Report the ROM class memory saved by -XX:+CompressROMClassDebugInfo */
+	if (0 != classLoader->compressedDebugInfoInlineBytes) {
+		_OutputStream.writeCharacters("3CLCMPDBGINFO\t\t\tCompressed debug info ");
+		_OutputStream.writeInteger(classLoader->compressedDebugInfoStoredBytes, "%zu");
+		_OutputStream.writeCharacters(" bytes for ");
+		_OutputStream.writeInteger(classLoader->compressedDebugInfoInlineBytes, "%zu");
+		_OutputStream.writeCharacters(" bytes of ROM class data\n");
+	}
+
 	if (avoidLocks()) {
 		_OutputStream.writeCharacters("3CLNMBRLOADEDCL\t\t\tNumber of loaded classes ");
 		_OutputStream.writeInteger(hashTableGetCount(classLoader->classHashTable), "%zu");
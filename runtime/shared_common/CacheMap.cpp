@@ -2293,6 +2293,9 @@ SH_CacheMap::commitROMClass(J9VMThread* currentThread, ShcItem* itemInCache, SH_
 	/*If storeNew() fails, we still need to update the segment list, and commit the update.*/
 	cacheAreaForAllocate->commitUpdate(currentThread, false);
 	updateROMSegmentList(currentThread, true);
+	if (storeResult) {
+		_rcm->updatePersistedIndex(currentThread, cacheAreaForAllocate, false);
+	}
 
 	/* Try to reset the writeHash field in the cache. We have loaded a class from disk have now stored it.
 	 CMVC 93940 z/OS PERFORMANCE: Only reset the writeHash field on non-orphan store */
@@ -2379,6 +2382,9 @@ SH_CacheMap::commitOrphanROMClass(J9VMThread* currentThread, ShcItem* itemInCach
 	/*If storeNew() fails, we still need to update the segment list, and commit the update.*/
 	cacheAreaForAllocate->commitUpdate(currentThread, false);
 	updateROMSegmentList(currentThread, true);
+	if (storeResult) {
+		_rcm->updatePersistedIndex(currentThread, cacheAreaForAllocate, false);
+	}
 
 	/* Try to reset the writeHash field in the cache. We have loaded a class from disk have now stored it.
 	 CMVC 93940 z/OS PERFORMANCE: Only reset the writeHash field on non-orphan store */
@@ -2944,7 +2950,12 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 		}
 		break;
 	case TYPE_ATTACHED_DATA:
-		if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
+		if (J9SHR_ATTACHED_DATA_TYPE_VERIFIED == resourceSubType) {
+			if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_BLOCK_DATA_UPDATE)) {
+				increaseUnstoredBytes(totalLength);
+				return NULL;
+			}
+		} else if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
 			return NULL;
 		}
 		break;
@@ -2988,6 +2999,9 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 			(J9SHR_ATTACHED_DATA_TYPE_JITHINT == resourceSubType)
 		){
 			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateJIT(currentThread, itemPtr, dataLength));
+		} else if (J9SHR_ATTACHED_DATA_TYPE_VERIFIED == resourceSubType) {
+			/* Verified class records are class metadata, not JIT data */
+			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateBlock(currentThread, itemPtr, align, wrapperLength));
 		}
 		break;
 	default :
@@ -3455,7 +3469,10 @@ SH_CacheMap::storeAttachedData(J9VMThread* currentThread, const void* addressInC
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* verboseJITData describes the JIT data keyed by ROM methods */
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data->type)
+	) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char *pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data->type);
@@ -3534,7 +3551,10 @@ SH_CacheMap::updateAttachedData(J9VMThread* currentThread, const void* addressIn
 		Trc_SHR_CM_updateAttachedData_Exit1(currentThread);
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* verboseJITData describes the JIT data keyed by ROM methods */
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data->type)
+	) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data->type);
@@ -3612,7 +3632,10 @@ SH_CacheMap::updateAttachedUDATA(J9VMThread* currentThread, const void* addressI
 	data.length = sizeof(UDATA);
 	data.type = type;
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* verboseJITData describes the JIT data keyed by ROM methods */
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data.type)
+	) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data.type);
@@ -3677,7 +3700,10 @@ SH_CacheMap::findAttachedDataAPI(J9VMThread* currentThread, const void* addressI
 
 	Trc_SHR_CM_findAttachedDataAPI_Entry(currentThread, addressInCache, addressInCache);
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* verboseJITData describes the JIT data keyed by ROM methods */
+	if ((localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data->type)
+	) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		subcstr[0] = 0;
@@ -4468,6 +4494,8 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 
 	descriptor->objectBytes = 0;
 	descriptor->numObjects = 0;
+	descriptor->verifiedClassDataBytes = 0;
+	descriptor->numVerifiedClasses = 0;
 	
 	if (_adm && (MANAGER_STATE_STARTED == _adm->getState())) {
 		UDATA type;
@@ -4483,6 +4511,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->jitHintDataBytes += _adm->getDataBytesForType(type);
 				descriptor->numJitHints += _adm->getNumOfType(type);
 				break;
+			case J9SHR_ATTACHED_DATA_TYPE_VERIFIED:
+				descriptor->verifiedClassDataBytes += _adm->getDataBytesForType(type);
+				descriptor->numVerifiedClasses += _adm->getNumOfType(type);
+				break;
 			default:
 				Trc_SHR_CM_getJavacoreData_InvalidAttachedDataType(type);
 				Trc_SHR_Assert_ShouldNeverHappen();
@@ -4502,6 +4534,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 					descriptor->jclDataBytes -
 					descriptor->jitHintDataBytes -
 					descriptor->jitProfileDataBytes -
+					descriptor->verifiedClassDataBytes -
 					descriptor->aotDataBytes -
 					descriptor->aotClassChainDataBytes -
 					descriptor->aotThunkDataBytes -
@@ -4534,6 +4567,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	}
 	if (_cpm && (_cpm->getState() == MANAGER_STATE_STARTED)) {
 		_cpm->getNumItemsByType(&(descriptor->numClasspaths), &(descriptor->numURLs), &(descriptor->numTokens));
+		descriptor->numTimestampChecksAvoided = _cpm->getTimestampChecksAvoided();
 	}
 
 	if ((U_32)-1 != descriptor->softMaxBytes) {
@@ -5224,6 +5258,8 @@ SH_CacheMap::printCacheStatsTopLayerStatsHelper(J9VMThread* currentThread, UDATA
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_JIT_MAX, javacoreData->maxJIT);
 	if (J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_DETAILED_STATS)) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_READWRITE_BYTES, javacoreData->readWriteBytes);
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_WRITE_MUTEX_CONTENDED, javacoreData->cacheWriteMutexContendedCount);
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_WRITE_MUTEX_CONTENDED_WAIT, javacoreData->cacheWriteMutexContendedMicros);
 	}
 	if (!multiLayerStats) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_META_BYTES_V2, javacoreData->otherBytes);
@@ -7294,6 +7330,8 @@ SH_CacheMap::attachedTypeString(UDATA type)
 		return "JITPROFILE";
 	case J9SHR_ATTACHED_DATA_TYPE_JITHINT:
 		return "JITHINT";
+	case J9SHR_ATTACHED_DATA_TYPE_VERIFIED:
+		return "VERIFIED";
 	default:
 		Trc_SHR_CM_attachedTypeString_Error(type);
 		Trc_SHR_Assert_ShouldNeverHappen();
@@ -7786,6 +7824,30 @@ done:
 	return;
 }
 
+/**
+ * Bring the persisted ROMClass index up to date with the classes stored since it was last updated,
+ * so that JVMs starting later do not have to walk them. Index updates are batched while classes are stored.
+ *
+ * @param [in] currentThread pointer to current J9VMThread
+ *
+ * @return void
+ */
+void
+SH_CacheMap::flushPersistedROMClassIndex(J9VMThread *currentThread)
+{
+	const char *fnName = "flushPersistedROMClassIndex";
+
+	if ((NULL == _rcm) || _ccHead->isRunningReadOnly()) {
+		return;
+	}
+	if (0 != _ccHead->enterWriteMutex(currentThread, false, fnName)) {
+		Trc_SHR_CM_flushPersistedROMClassIndex_FailedToAcquireWriteMutex(currentThread);
+		return;
+	}
+	_rcm->updatePersistedIndex(currentThread, _ccHead, true);
+	_ccHead->exitWriteMutex(currentThread, fnName);
+}
+
 /* Adjust the minAOT, maxAOT, minJIT, maxJIT and softMaxBytes in the cache header.
  *
  * @param [in] currentThread Pointer to J9VMThread structure for the current thread
@@ -277,6 +277,8 @@ public:
 
 	void protectPartiallyFilledPages(J9VMThread *currentThread);
 
+	void flushPersistedROMClassIndex(J9VMThread *currentThread);
+
 	I_32 tryAdjustMinMaxSizes(J9VMThread* currentThread, bool isJCLCall = false);
 
 	void updateRuntimeFullFlags(J9VMThread* currentThread);
@@ -51,7 +51,9 @@ SH_ClasspathManagerImpl2::SH_ClasspathManagerImpl2()
    _classpathCount(0), 
    _urlCount(0), 
    _tokenCount(0),
-   _allCacheletsStarted(false)
+   _allCacheletsStarted(false),
+   _timestampCheckInterval(0),
+   _timestampChecksAvoided(0)
 {
    _htMutexName = "cpeTableMutex";
 }
@@ -208,7 +210,9 @@ SH_ClasspathManagerImpl2::CpLinkedListHdr::CpLinkedListHdr(const char* key_, U_1
    _flags(0),
    _keySize(keySize_),
    _key(key_),
-   _list(listItem)
+   _list(listItem),
+   _lastTimestampCheck(0),
+   _checkedTimestamp(-1)
 {
 }
 
@@ -250,6 +254,7 @@ SH_ClasspathManagerImpl2::initialize(J9JavaVM* vm, SH_SharedCache* cache_, SH_Ti
 	_cache = cache_;
 	_tsm = tsm_;
 	_portlib = vm->portLibrary;
+	_timestampCheckInterval = vm->sharedCacheAPI->timestampCheckInterval;
 	_htMutex = NULL;
 	_identifiedMutex = NULL;
 	_dataTypesRepresented[0] = TYPE_CLASSPATH;
@@ -369,6 +374,9 @@ SH_ClasspathManagerImpl2::getRequiredConstrBytes(void)
 
 /* Make decisions about which entries to actually timestamp
  * Returns 1 if item is stampable and time has changed, 0 if it has not changed, JAR_LOCKED if it was not checked and -1 for error
+ *
+ * If timestampCheckInterval= was specified, a container found unchanged is not checked again
+ * until the interval has elapsed, as long as the timestamp being compared against is the one that was checked.
  */
 IDATA
 SH_ClasspathManagerImpl2::hasTimestampChanged(J9VMThread* currentThread, ClasspathEntryItem* itemToCheck, CpLinkedListHdr* knownLLH, bool doTryLockJar)
@@ -385,6 +393,7 @@ SH_ClasspathManagerImpl2::hasTimestampChanged(J9VMThread* currentThread, Classpa
 		U_16 pathLen = 0;
 		const char* itemPath = NULL;
 		I_64 newTS;
+		I_64 now = 0;
 		CpLinkedListHdr* header;
 
 		if (knownLLH) {
@@ -405,8 +414,28 @@ SH_ClasspathManagerImpl2::hasTimestampChanged(J9VMThread* currentThread, Classpa
 			return JAR_LOCKED;
 		}
 
+		if (0 != _timestampCheckInterval) {
+			PORT_ACCESS_FROM_PORT(_portlib);
+
+			now = j9time_current_time_millis();
+			if ((0 == (header->_flags & (CPM_ZIP_FORCE_CHECK_TIMESTAMP | CPM_ZIP_ONLY_TIMESTAMP_ON_INIT)))
+				&& (itemToCheck->timestamp == header->_checkedTimestamp)
+				&& ((now - header->_lastTimestampCheck) >= 0)
+				&& ((UDATA)(now - header->_lastTimestampCheck) < _timestampCheckInterval)
+			) {
+				_timestampChecksAvoided += 1;
+				Trc_SHR_CMI_hasTimestampChanged_ExitRecentlyChecked(currentThread, header);
+				return 0;
+			}
+		}
+
 		newTS = _tsm->checkCPEITimeStamp(currentThread, itemToCheck);
 
+		if ((0 != _timestampCheckInterval) && (TIMESTAMP_UNCHANGED == newTS)) {
+			header->_checkedTimestamp = itemToCheck->timestamp;
+			header->_lastTimestampCheck = now;
+		}
+
 		/* If only timestamping the container once, mark it so that it won't be checked again */
 		if (header->_flags & CPM_ZIP_ONLY_TIMESTAMP_ON_INIT) {
 			header->_flags &= ~CPM_ZIP_ONLY_TIMESTAMP_ON_INIT;
@@ -1454,6 +1483,13 @@ SH_ClasspathManagerImpl2::getNumItemsByType(UDATA* numClasspaths, UDATA* numURLs
 	*numTokens = _tokenCount;
 }
 
+/* Returns the number of container timestamp checks skipped because of timestampCheckInterval= */
+UDATA
+SH_ClasspathManagerImpl2::getTimestampChecksAvoided(void)
+{
+	return _timestampChecksAvoided;
+}
+
 #if defined(J9SHR_CACHELET_SUPPORT)
 
 /**
@@ -72,6 +72,8 @@ public:
 
 	virtual void getNumItemsByType(UDATA* numClasspaths, UDATA* numURLs, UDATA* numTokens);
 
+	virtual UDATA getTimestampChecksAvoided(void);
+
 	void runExitCode(void) {};	
 
 protected:
@@ -104,6 +106,8 @@ private:
 	struct J9ClasspathByIDArray* _identifiedClasspaths;
 	UDATA _classpathCount, _urlCount, _tokenCount;
 	bool _allCacheletsStarted;
+	UDATA _timestampCheckInterval;
+	UDATA _timestampChecksAvoided;
 	
 	/** 
 	 * Circular linked list for storing local classpath entry information.
@@ -135,6 +139,8 @@ class CpLinkedListImpl : public SH_Manager::LinkedListImpl
 	 * Contains local data about classpath entry (Key).
 	 *   isLocked is set to true if the classpath entry is locked by the
 	 *   classloader and therefore does not need timestamp checking.
+	 *   lastTimestampCheck and checkedTimestamp record the time and result of the last
+	 *   timestamp check which found the entry unchanged, see hasTimestampChanged.
 	 * isToken is important. A Token with "/foo/bar" is different to a URL with "/foo/bar".
 	 *
 	 * @ingroup Shared_Common
@@ -150,6 +156,8 @@ class CpLinkedListImpl : public SH_Manager::LinkedListImpl
 		U_16 _keySize;
 		const char* _key;
 		CpLinkedListImpl* _list;
+		I_64 _lastTimestampCheck;
+		I_64 _checkedTimestamp;
 	};
 
 	static UDATA cpeHashFn(void* item, void *userData);
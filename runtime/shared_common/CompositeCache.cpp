@@ -114,6 +114,8 @@
 
 #define CC_READONLY_LOCK_VALUE (U_32)-1
 #define CC_MAX_READONLY_WAIT_FOR_CACHE_LOCK_MILLIS 100
+/* Acquiring an uncontended write mutex takes a few microseconds at most, so a longer wait means another writer held it */
+#define CC_WRITE_MUTEX_CONTENDED_MICROS 50
 
 #define CC_COULD_NOT_ENTER_STRINGTABLE_ON_STARTUP 0xdeadbeef
 
@@ -156,9 +158,9 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->writerCount = 0;
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
-	ca->unused10 = 0;
+	ca->romClassIndexSRP = 0;
+	ca->writeMutexContendedCount = 0;
+	ca->writeMutexContendedMicros = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
 	WSRP_SET(ca->corruptFlagPtr, &(ca->corruptFlag));
@@ -239,6 +241,8 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_prevScan = NULL;
 	_storedScan = NULL;
 	_storedPrevScan = NULL;
+	_romClassIndexAreaStart = NULL;
+	_romClassIndexAreaEnd = NULL;
 	_oldUpdateCount = 0;
 	_totalStoredBytes = _storedMetaUsedBytes = _storedSegmentUsedBytes = _storedAOTUsedBytes = _storedJITUsedBytes = _storedReadWriteUsedBytes = 0;
 	_softmxUnstoredBytes = 0;
@@ -1989,7 +1993,12 @@ SH_CompositeCacheImpl::nextEntry(J9VMThread* currentThread, UDATA* staleItems)
  * Allows only single-threaded writing to the cache.
  * Write mutex allows multiple concurrent readers, unless lockCache
  * is set to true, in which case it blocks until all readers have finished.
- * 
+ *
+ * Cache space is both allocated and committed under this mutex. Other JVMs find new items by walking
+ * the metadata area up to updateSRP, and could not tell space reserved by a writer which has not yet
+ * published it from a write interrupted by a crash. Waits for the mutex of CC_WRITE_MUTEX_CONTENDED_MICROS
+ * or more are counted as contended, and reported by the javacore and printStats.
+ *
  * @param [in] currentThread  Point to the J9VMThread struct for the current thread
  * @param [in] lockCache  Set to true if whole cache should be locked for this write
  * @param [in] caller String to identify the calling thread
@@ -2002,6 +2011,9 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	IDATA rc;
 	SH_OSCache* oscacheToUse = ((_ccHead == NULL) ? _oscache : _ccHead->_oscache); 
 	const char *fname = "enterWriteMutex";
+	U_64 waitMicros = 0;
+	bool contended = false;
+	PORT_ACCESS_FROM_PORT(_portlib);
 
 	Trc_SHR_CC_enterWriteMutex_Enter(currentThread, lockCache, caller);
 	
@@ -2019,13 +2031,24 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasReadWriteMutexThread);
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasRefreshMutexThread);
 
+	waitMicros = j9time_usec_clock();
 	if (oscacheToUse) {
 		rc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID);
 	} else {
 		rc = omrthread_monitor_enter(_utMutex);
 	}
 	if (rc == 0) {
+		U_64 acquiredTime = j9time_usec_clock();
+
+		waitMicros = acquiredTime - waitMicros;
+		contended = (waitMicros >= CC_WRITE_MUTEX_CONTENDED_MICROS);
 		_commonCCInfo->hasWriteMutexThread = currentThread;
+		_commonCCInfo->writeMutexAcquiredTime = acquiredTime;
+		_commonCCInfo->writeMutexAcquireCount += 1;
+		_commonCCInfo->writeMutexWaitMicros += waitMicros;
+		if (contended) {
+			_commonCCInfo->writeMutexContendedCount += 1;
+		}
 		if (*_runtimeFlags & J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES) {
 			/*Pass doDecWriteCounter=false b/c exitWriteMutex is being called without updating writerCount*/
 			exitWriteMutex(currentThread, fname, false);
@@ -2043,6 +2066,11 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 
 		this->_commonCCInfo->oldWriterCount = _theca->writerCount;
 		_theca->writerCount += 1;
+		if (contended) {
+			/* Totals for all JVMs sharing the cache, reported by printStats */
+			_theca->writeMutexContendedCount += 1;
+			_theca->writeMutexContendedMicros += (UDATA)waitMicros;
+		}
 		protectHeaderReadWriteArea(currentThread, false);
 	}
 	if (rc == -1) {
@@ -2097,6 +2125,10 @@ SH_CompositeCacheImpl::exitWriteMutex(J9VMThread* currentThread, const char* cal
 
 	doUnlockCache(currentThread);
 	_commonCCInfo->hasWriteMutexThread = NULL;
+	{
+		PORT_ACCESS_FROM_PORT(_portlib);
+		_commonCCInfo->writeMutexHoldMicros += j9time_usec_clock() - _commonCCInfo->writeMutexAcquiredTime;
+	}
 	if (oscacheToUse) {
 		rc = oscacheToUse->releaseWriteLock(_commonCCInfo->writeMutexID);
 	} else {
@@ -3353,6 +3385,184 @@ SH_CompositeCacheImpl::stale(BlockPtr blockEnd)
 	return (CCITEMSTALE(ih)) ? 1 : 0;
 }
 
+/**
+ * Get the persisted ROMClass index of this cache.
+ *
+ * @return The index, or NULL if the cache has no index or the index cannot be trusted
+ * because it is damaged, has a different version or a JVM crashed updating the cache since it was created.
+ */
+ROMClassIndexWrapper*
+SH_CompositeCacheImpl::getROMClassIndex(void)
+{
+	UDATA indexSRP = 0;
+	ShcItem* item = NULL;
+	ROMClassIndexWrapper* index = NULL;
+	U_32 slotCount = 0;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	indexSRP = _theca->romClassIndexSRP;
+	if ((0 == indexSRP) || (indexSRP <= sizeof(ShcItem)) || (indexSRP >= _theca->totalBytes)) {
+		return NULL;
+	}
+	index = (ROMClassIndexWrapper*)((BlockPtr)_theca + indexSRP);
+	item = (ShcItem*)((BlockPtr)index - sizeof(ShcItem));
+	if (!isAddressInMetaDataArea(item) || (TYPE_ROMCLASS_INDEX != ITEMTYPE(item))) {
+		return NULL;
+	}
+	slotCount = index->slotCount;
+	if ((ROMCLASS_INDEX_VERSION != index->version)
+		|| (index->crashCntr != (U_32)_theca->crashCntr)
+		|| (0 == slotCount)
+		|| (0 != (slotCount & (slotCount - 1)))
+		|| (ITEMDATALEN(item) < RCIWLEN((UDATA)slotCount))
+	) {
+		return NULL;
+	}
+	return index;
+}
+
+/**
+ * Make index the persisted ROMClass index of this cache.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] index  A committed index in the metadata area of this cache
+ *
+ * @pre The caller MUST hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setROMClassIndex(J9VMThread* currentThread, ROMClassIndexWrapper* index)
+{
+	if (!_started || _readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_Equals(currentThread, _commonCCInfo->hasWriteMutexThread);
+
+	unprotectHeaderReadWriteArea(currentThread, false);
+	_theca->crcValid = 0;
+	/* The index must be complete before other JVMs can find it */
+	VM_AtomicSupport::writeBarrier();
+	_theca->romClassIndexSRP = (UDATA)((BlockPtr)index - (BlockPtr)_theca);
+	protectHeaderReadWriteArea(currentThread, false);
+	Trc_SHR_CC_setROMClassIndex_Event(currentThread, index, index->slotCount, index->entryCount);
+}
+
+/**
+ * Make the persisted ROMClass index writable so that a batch of entries can be added to it.
+ * The pages holding the index are unprotected once for the whole batch, and the cache CRC is invalidated.
+ * Every call must be followed by endROMClassIndexUpdate() before the write mutex is released.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] index  The index, which may be in committed metadata
+ *
+ * @pre The caller MUST hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::startROMClassIndexUpdate(J9VMThread* currentThread, ROMClassIndexWrapper* index)
+{
+	if (!_started || _readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_Equals(currentThread, _commonCCInfo->hasWriteMutexThread);
+	Trc_SHR_Assert_True(NULL == _romClassIndexAreaStart);
+
+	if (0 != _theca->crcValid) {
+		unprotectHeaderReadWriteArea(currentThread, false);
+		_theca->crcValid = 0;
+		protectHeaderReadWriteArea(currentThread, false);
+	}
+
+	/* As in markStale(), only pages above _prevScan are protected and a locked cache has the whole metadata area unprotected */
+	if (_doMetaProtect && !isLocked() && (_osPageSize != 0)) {
+		BlockPtr areaStart = (BlockPtr)ROUND_DOWN_TO(_osPageSize, (UDATA)index);
+		BlockPtr areaEnd = (BlockPtr)ROUND_UP_TO(_osPageSize, (UDATA)(RCIWSLOTS(index) + index->slotCount));
+
+		while ((areaStart < areaEnd) && ((UDATA)areaStart <= (UDATA)_prevScan)) {
+			areaStart += _osPageSize;
+		}
+		if (areaStart < areaEnd) {
+			if (setRegionPermissions(_portlib, (void*)areaStart, areaEnd - areaStart, (J9PORT_PAGE_PROTECT_WRITE | J9PORT_PAGE_PROTECT_READ)) != 0) {
+				PORT_ACCESS_FROM_PORT(_portlib);
+				I_32 myerror = j9error_last_error_number();
+				Trc_SHR_CC_ROMClassIndexUpdate_setRegionPermissions_Failed(myerror);
+				Trc_SHR_Assert_ShouldNeverHappen();
+			}
+			_romClassIndexAreaStart = areaStart;
+			_romClassIndexAreaEnd = areaEnd;
+		}
+	}
+}
+
+/**
+ * Protect the pages of the persisted ROMClass index made writable by startROMClassIndexUpdate().
+ *
+ * @param [in] currentThread  The current thread
+ *
+ * @pre The caller MUST hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::endROMClassIndexUpdate(J9VMThread* currentThread)
+{
+	Trc_SHR_Assert_Equals(currentThread, _commonCCInfo->hasWriteMutexThread);
+
+	if (NULL != _romClassIndexAreaStart) {
+		if (setRegionPermissions(_portlib, (void*)_romClassIndexAreaStart, _romClassIndexAreaEnd - _romClassIndexAreaStart, J9PORT_PAGE_PROTECT_READ) != 0) {
+			PORT_ACCESS_FROM_PORT(_portlib);
+			I_32 myerror = j9error_last_error_number();
+			Trc_SHR_CC_ROMClassIndexUpdate_setRegionPermissions_Failed(myerror);
+			Trc_SHR_Assert_ShouldNeverHappen();
+		}
+		_romClassIndexAreaStart = NULL;
+		_romClassIndexAreaEnd = NULL;
+	}
+}
+
+/**
+ * Find the committed item allocated directly after the item at itemOffset, without moving the scan pointer.
+ *
+ * @param [in] itemOffset  Offset of an item from the cache header, or getMetadataEndOffset() to find the first item
+ *
+ * @return The item found, or NULL if there are no more committed items or the item header is damaged
+ */
+ShcItem*
+SH_CompositeCacheImpl::nextCommittedEntry(U_32 itemOffset)
+{
+	ShcItemHdr* ih = NULL;
+	BlockPtr free = NULL;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	ih = (ShcItemHdr*)((BlockPtr)_theca + itemOffset - sizeof(ShcItemHdr));
+	free = UPDATEPTR(_theca);
+	if ((BlockPtr)ih > free) {
+		UDATA maxCCItemLen = (((UDATA)ih) - ((UDATA)free)) + sizeof(ShcItemHdr);
+
+		if ((CCITEMLEN(ih) > 0) && (CCITEMLEN(ih) <= maxCCItemLen)) {
+			return (ShcItem*)CCITEM(ih);
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @return Offset from the cache header of the end of the metadata area, where the first item is allocated
+ */
+U_32
+SH_CompositeCacheImpl::getMetadataEndOffset(void)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return 0;
+	}
+	return (U_32)(CADEBUGSTART(_theca) - (BlockPtr)_theca);
+}
+
 /**
  * Sets nextEntry pointer back to the start of the cache.
  *
@@ -4695,6 +4905,8 @@ SH_CompositeCacheImpl::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDe
 		descriptor->minJIT = _theca->minJIT;
 		descriptor->maxJIT = _theca->maxJIT;
 		descriptor->softMaxBytes = (UDATA)((U_32)-1 == _theca->softMaxBytes ? descriptor->cacheSize : _theca->softMaxBytes);
+		descriptor->cacheWriteMutexContendedCount = _theca->writeMutexContendedCount;
+		descriptor->cacheWriteMutexContendedMicros = _theca->writeMutexContendedMicros;
 
 		if ((NULL != _debugData) && !_debugData->getJavacoreData(vm, descriptor, _theca)) {
 			return 0;
@@ -4703,6 +4915,10 @@ SH_CompositeCacheImpl::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDe
 
 	descriptor->writeLockTID = _commonCCInfo->hasWriteMutexThread;
 	descriptor->readWriteLockTID = _commonCCInfo->hasReadWriteMutexThread;
+	descriptor->writeMutexAcquireCount = _commonCCInfo->writeMutexAcquireCount;
+	descriptor->writeMutexContendedCount = _commonCCInfo->writeMutexContendedCount;
+	descriptor->writeMutexWaitMicros = (UDATA)_commonCCInfo->writeMutexWaitMicros;
+	descriptor->writeMutexHoldMicros = (UDATA)_commonCCInfo->writeMutexHoldMicros;
 
 	return 1;
 }
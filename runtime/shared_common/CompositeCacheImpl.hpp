@@ -159,6 +159,18 @@ public:
 	void markStale(J9VMThread* currentThread, BlockPtr block, bool isCacheLocked);
 
 	UDATA stale(BlockPtr block);
+
+	ROMClassIndexWrapper* getROMClassIndex(void);
+
+	void setROMClassIndex(J9VMThread* currentThread, ROMClassIndexWrapper* index);
+
+	void startROMClassIndexUpdate(J9VMThread* currentThread, ROMClassIndexWrapper* index);
+
+	void endROMClassIndexUpdate(J9VMThread* currentThread);
+
+	ShcItem* nextCommittedEntry(U_32 itemOffset);
+
+	U_32 getMetadataEndOffset(void);
 	
 	void findStart(J9VMThread* currentThread);
 	
@@ -466,6 +478,8 @@ private:
 	ShcItemHdr* _storedScan;
 	ShcItemHdr* _storedPrevScan;
 	BlockPtr _romClassProtectEnd;
+	BlockPtr _romClassIndexAreaStart;
+	BlockPtr _romClassIndexAreaEnd;
 
 	UDATA _oldUpdateCount;
 
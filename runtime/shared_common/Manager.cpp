@@ -32,6 +32,7 @@
 #include "j9shrnls.h"
 #include "CacheMap.hpp"
 #include "AtomicSupport.hpp"
+#include <string.h>
 
 /**
  * Constructor
@@ -57,6 +58,8 @@ SH_Manager::SH_Manager()
 	,_allCacheletsStarted(false)
 #endif
 {
+	/* Managers representing fewer than MAX_TYPES_PER_MANAGER types leave the remaining slots unused */
+	memset(_dataTypesRepresented, 0, sizeof(_dataTypesRepresented));
 }
 
 /**
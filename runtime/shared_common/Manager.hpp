@@ -43,7 +43,7 @@
 
 #define STACK_STRINGBUF_SIZE 512
 
-#define MAX_TYPES_PER_MANAGER 3
+#define MAX_TYPES_PER_MANAGER 4
 
 class SH_Managers;
 class SH_SharedCache;
@@ -157,7 +157,7 @@ public:
 	/* This function must be implemented by the manager subclass - it should store the new item given in its hashtable */
 	virtual bool storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet) = 0;
 	
-	void getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
+	virtual void getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
 	
 	IDATA reset(J9VMThread* currentThread);
 	
@@ -262,6 +262,9 @@ protected:
 	/* This function is the lookup entry point for a manager linked list hashtable */
 	HashLinkedListImpl* hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nameLen, bool allowCacheletStartup);
 
+	/* This function looks up a key in the hashtable. The caller must hold the hashtable mutex */
+	HashLinkedListImpl* hllTableLookupHelper(J9VMThread* currentThread, U_8* key, U_16 keySize, UDATA hashValue, SH_CompositeCache* cachelet);
+
 	/* This function is the update entry point for a manager linked list hashtable */
 	HashLinkedListImpl* hllTableUpdate(J9VMThread* currentThread, const J9Pool* linkPool, const J9UTF8* key, const ShcItem* item, SH_CompositeCache* cachelet);
 
@@ -310,7 +313,6 @@ private:
 	void tearDownHashTable(J9VMThread* currentThread);
 
 	HashLinkedListImpl* hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const J9UTF8* key, const ShcItem* item, UDATA hashPrimeValue, SH_CompositeCache* cachelet, HashLinkedListImpl** addToList);
-	HashLinkedListImpl* hllTableLookupHelper(J9VMThread* currentThread, U_8* key, U_16 keySize, UDATA hashValue, SH_CompositeCache* cachelet);
 
 	static UDATA countItemsInList(void* node, void* countData);
 
@@ -68,6 +68,8 @@ public:
 	virtual const J9ROMClass* findNextExisting(J9VMThread* currentThread, void * &findNextIterator, void * &firstFound, U_16 classnameLength, const char* classnameData) = 0;
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen) = 0;
+
+	virtual void updatePersistedIndex(J9VMThread* currentThread, SH_CompositeCache* cachelet, bool flush) = 0;
 	
 };
 
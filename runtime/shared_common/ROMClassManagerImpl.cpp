@@ -29,14 +29,38 @@
 #include "ClasspathManager.hpp"
 #include "ScopeManager.hpp"
 #include "SharedCache.hpp"
+#include "CompositeCacheImpl.hpp"
+#include "AtomicSupport.hpp"
 #include "ut_j9shr.h"
 #include "j9shrnls.h"
 #include "j9consts.h"
 #include <string.h>
 
+/* The smallest persisted index created. An index is rebuilt at least twice the size when it is half full. */
+#define ROMCLASS_INDEX_MIN_SLOTS 1024
+#define ROMCLASS_INDEX_MAX_SLOTS (1 << 24)
+/* Number of indexed items stored by this JVM before the persisted index is brought up to date */
+#define ROMCLASS_INDEX_BATCH_SIZE 64
+
+/* Return values of addToPersistedIndex() */
+#define ROMCLASS_INDEX_ENTRY_ADDED 1
+#define ROMCLASS_INDEX_ENTRY_EXISTS 0
+#define ROMCLASS_INDEX_FULL -1
+
+/* Data for loadForExistingKeyDoFn() */
+struct LoadForExistingKeyData {
+	SH_ROMClassManagerImpl* rcm;
+	J9VMThread* currentThread;
+	UDATA layer;
+};
+
 SH_ROMClassManagerImpl::SH_ROMClassManagerImpl()
  : _tsm(0),
-   _linkedListImplPool(0)
+   _linkedListImplPool(0),
+   _persistedIndexCount(0),
+   _persistedIndexesInUse(false),
+   _persistedIndexUpdateFailed(false),
+   _unindexedStores(0)
 {
 }
 
@@ -53,6 +77,9 @@ SH_ROMClassManagerImpl::localHashTableCreate(J9VMThread* currentThread, U_32 ini
 	Trc_SHR_RMI_localHashTableCreate_Entry(currentThread, initialEntries);
 	returnVal = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), initialEntries, sizeof(SH_Manager::HashLinkedListImpl*), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, SH_Manager::hllHashFn, SH_Manager::hllHashEqualFn, NULL, (void*)currentThread->javaVM->internalVMFunctions);
 	_hashTableGetNumItemsDoFn = SH_ROMClassManagerImpl::customCountItemsInList;
+	/* The persisted indexes are adopted again as the new hashtable is populated */
+	_persistedIndexCount = 0;
+	_persistedIndexesInUse = false;
 	Trc_SHR_RMI_localHashTableCreate_Exit(currentThread, returnVal);
 	return returnVal;
 }
@@ -95,6 +122,7 @@ SH_ROMClassManagerImpl::initialize(J9JavaVM* vm, SH_SharedCache* cache_, SH_Time
 	_dataTypesRepresented[0] = TYPE_ROMCLASS;
 	_dataTypesRepresented[1] = TYPE_ORPHAN;
 	_dataTypesRepresented[2] = TYPE_SCOPED_ROMCLASS;
+	_dataTypesRepresented[3] = TYPE_ROMCLASS_INDEX;
 
 	notifyManagerInitialized(_cache->managers(), "TYPE_ROMCLASS");
 
@@ -164,15 +192,58 @@ SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
  */
 bool 
 SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
+{
+	PersistedIndex* persistedIndex = NULL;
+	bool result = false;
+
+	if (getState() != MANAGER_STATE_STARTED) {
+		return false;
+	}
+	if (TYPE_ROMCLASS_INDEX == ITEMTYPE(itemInCache)) {
+		/* The index in use is found from the cache header, not from the items */
+		return true;
+	}
+
+	persistedIndex = getPersistedIndex(currentThread, (SH_CompositeCacheImpl*)cachelet);
+	if ((NULL != persistedIndex)
+		&& (NULL != persistedIndex->index)
+		&& ((U_32)((BlockPtr)itemInCache - persistedIndex->cacheHeader) >= persistedIndex->boundaryOffset)
+	) {
+		/* The item is loaded from the index when its class name is first looked up */
+		Trc_SHR_RMI_storeNew_InPersistedIndex_Event(currentThread, itemInCache);
+		return true;
+	}
+
+	if (_persistedIndexesInUse) {
+		J9UTF8* utf8Name = getItemClassName(itemInCache);
+		U_16 keyLength = getIndexKeyLength(utf8Name);
+
+		if (!lockHashTable(currentThread, "storeNew")) {
+			PORT_ACCESS_FROM_PORT(_portlib);
+			M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
+			return false;
+		}
+		/* Any indexed items for the name are older than this one, so must be in the hashtable first */
+		if (NULL == hllTableLookupHelper(currentThread, J9UTF8_DATA(utf8Name), keyLength, 0, NULL)) {
+			loadFromPersistedIndexes(currentThread, J9UTF8_DATA(utf8Name), keyLength, 0, _persistedIndexCount);
+		}
+		result = storeItem(currentThread, itemInCache, cachelet);
+		unlockHashTable(currentThread, "storeNew");
+	} else {
+		result = storeItem(currentThread, itemInCache, cachelet);
+	}
+	return result;
+}
+
+/* Adds a ROMClass, scoped ROMClass or orphan item to the local hashtable */
+bool
+SH_ROMClassManagerImpl::storeItem(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
 {
 	HashLinkedListImpl* result = NULL;
 	bool orphanReunited = false;
 	J9ROMClass* romClass = NULL;
 	J9UTF8* utf8Name = NULL;
 
-	if (getState() != MANAGER_STATE_STARTED) {
-		return false;
-	}
 	Trc_SHR_RMI_storeNew_Entry(currentThread, itemInCache);
 
 	if (ITEMTYPE(itemInCache) == TYPE_ORPHAN) {
@@ -276,7 +347,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 
 	if (findNextIterator == NULL) {
 		Trc_SHR_RMI_findNextROMClass_FirstElem_Event(currentThread);
-		walk = hllTableLookup(currentThread, classnameData, classnameLength, true);
+		walk = lookupClass(currentThread, classnameData, classnameLength);
 		firstFound = (void *)walk;
 		findNextIterator = (void *)walk;
 	} else {
@@ -338,7 +409,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 UDATA
 SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen)
 {
-	return (hllTableLookup(currentThread, path, (U_16)pathLen, true) != NULL);	
+	return (lookupClass(currentThread, path, (U_16)pathLen) != NULL);	
 }
 
 
@@ -399,7 +470,7 @@ SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* pa
 	result->foundAtIndex = -1;
 	result->staleCPEI = NULL;
 
-	found = hllTableLookup(currentThread, path, (U_16)pathLen, true);
+	found = lookupClass(currentThread, path, (U_16)pathLen);
 
 	if (!found) {
 		/*** NOTHING IS FOUND, TELL THE CALLER THAT IT MIGHT BE WORTH WAITING ***/
@@ -604,6 +675,540 @@ SH_ROMClassManagerImpl::checkTimestamp(J9VMThread* currentThread, const char* pa
 	return false;
 }
 
+/**
+ * Looks up a class name in the local hashtable, first loading the items for the name from the persisted indexes
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] name The class name
+ * @param[in] nameLen Length of the class name
+ *
+ * @return The list of items for the name, or NULL if there are none
+ */
+SH_Manager::HashLinkedListImpl*
+SH_ROMClassManagerImpl::lookupClass(J9VMThread* currentThread, const char* name, U_16 nameLen)
+{
+	HashLinkedListImpl* result = hllTableLookup(currentThread, name, nameLen, true);
+
+	if ((NULL == result) && _persistedIndexesInUse) {
+		if (lockHashTable(currentThread, "lookupClass")) {
+			/* Another thread may have loaded the name since the lookup above */
+			result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
+			if (NULL == result) {
+				if (0 != loadFromPersistedIndexes(currentThread, (const U_8*)name, nameLen, 0, _persistedIndexCount)) {
+					result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
+				}
+			}
+			unlockHashTable(currentThread, "lookupClass");
+		} else {
+			PORT_ACCESS_FROM_PORT(_portlib);
+			M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
+		}
+	}
+	return result;
+}
+
+/**
+ * Returns the persisted index of a cache layer, adopting the index of the layer when its first item is stored.
+ *
+ * A layer is adopted once per hashtable. An index created by another JVM after the layer was adopted is not used,
+ * as items it covers may already be in the hashtable.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cachelet The cache layer
+ *
+ * @return The persisted index of the layer, or NULL if the lock could not be obtained
+ */
+SH_ROMClassManagerImpl::PersistedIndex*
+SH_ROMClassManagerImpl::getPersistedIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cachelet)
+{
+	PersistedIndex* result = NULL;
+	UDATA count = _persistedIndexCount;
+	UDATA i = 0;
+
+	/* Entries below _persistedIndexCount are complete */
+	VM_AtomicSupport::readBarrier();
+	for (i = 0; i < count; i++) {
+		if (_persistedIndexes[i].cachelet == cachelet) {
+			return &_persistedIndexes[i];
+		}
+	}
+
+	if (!lockHashTable(currentThread, "getPersistedIndex")) {
+		PORT_ACCESS_FROM_PORT(_portlib);
+		M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
+		return NULL;
+	}
+	/* Another thread may have adopted the layer before the lock was obtained */
+	for (i = count; i < _persistedIndexCount; i++) {
+		if (_persistedIndexes[i].cachelet == cachelet) {
+			result = &_persistedIndexes[i];
+			break;
+		}
+	}
+	if ((NULL == result) && (_persistedIndexCount <= J9SH_LAYER_NUM_MAX_VALUE)) {
+		result = &_persistedIndexes[_persistedIndexCount];
+		result->cachelet = cachelet;
+		result->index = NULL;
+		result->cacheHeader = (BlockPtr)cachelet->getCacheHeaderAddress();
+		result->boundaryOffset = 0;
+		/* Cachelets and the stats walk read every item, so they do not use an index */
+		if (J9_ARE_NO_BITS_SET(*_runtimeFlagsPtr, J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_ENABLE_NESTED)) {
+			ROMClassIndexWrapper* index = cachelet->getROMClassIndex();
+
+			if (NULL != index) {
+				result->boundaryOffset = index->boundaryOffset;
+				/* Entries for items at or above the boundary are complete */
+				VM_AtomicSupport::readBarrier();
+				result->index = index;
+				Trc_SHR_RMI_getPersistedIndex_Adopted_Event(currentThread, cachelet, index, index->slotCount, index->entryCount, result->boundaryOffset);
+			}
+		}
+		VM_AtomicSupport::writeBarrier();
+		_persistedIndexCount += 1;
+
+		if (NULL != result->index) {
+			/* Names already in the hashtable come from lower layers. The full walk would add the items
+			 * of this layer for those names next, so they cannot wait for a lookup of the name.
+			 */
+			if (0 != hashTableGetCount(_hashTable)) {
+				LoadForExistingKeyData data;
+
+				data.rcm = this;
+				data.currentThread = currentThread;
+				data.layer = _persistedIndexCount - 1;
+				hashTableForEachDo(_hashTable, SH_ROMClassManagerImpl::loadForExistingKeyDoFn, &data);
+			}
+			_persistedIndexesInUse = true;
+		}
+	}
+	unlockHashTable(currentThread, "getPersistedIndex");
+	return result;
+}
+
+/* A hash table do function. Loads the items of one layer for the key of a hashtable entry. */
+UDATA
+SH_ROMClassManagerImpl::loadForExistingKeyDoFn(void* entry, void* userData)
+{
+	HashLinkedListImpl* node = *(HashLinkedListImpl**)entry;
+	LoadForExistingKeyData* data = (LoadForExistingKeyData*)userData;
+
+	data->rcm->loadFromPersistedIndexes(data->currentThread, node->_key, node->_keySize, data->layer, data->layer + 1);
+	return FALSE;
+}
+
+/**
+ * Adds the items for a key from the persisted indexes of a range of layers to the local hashtable.
+ * Items are added oldest first, as a walk of the cache would add them.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] key The hashtable key, see getIndexKeyLength()
+ * @param[in] keyLength Length of the key
+ * @param[in] firstLayer Position in _persistedIndexes of the first layer to load from
+ * @param[in] endLayer Position in _persistedIndexes after the last layer to load from
+ *
+ * @return The number of items added
+ *
+ * @pre The caller must hold the hashtable mutex
+ */
+UDATA
+SH_ROMClassManagerImpl::loadFromPersistedIndexes(J9VMThread* currentThread, const U_8* key, U_16 keyLength, UDATA firstLayer, UDATA endLayer)
+{
+	U_32 nameHash = hashIndexKey(currentThread, key, keyLength);
+	UDATA itemsLoaded = 0;
+	UDATA i = 0;
+
+	for (i = firstLayer; i < endLayer; i++) {
+		PersistedIndex* persistedIndex = &_persistedIndexes[i];
+		ROMClassIndexWrapper* index = persistedIndex->index;
+		ROMClassIndexSlot* slots = NULL;
+		U_32 mask = 0;
+		U_32 lastOffset = U_32_MAX;
+
+		if (NULL == index) {
+			continue;
+		}
+		slots = RCIWSLOTS(index);
+		mask = index->slotCount - 1;
+
+		/* The oldest item has the highest offset. Each pass of the probe sequence finds the next oldest item. */
+		for (;;) {
+			const ShcItem* nextItem = NULL;
+			U_32 nextOffset = 0;
+			U_32 slot = nameHash & mask;
+			U_32 probes = 0;
+
+			for (probes = 0; probes <= mask; probes++) {
+				U_32 itemOffset = slots[slot].itemOffset;
+
+				if (0 == itemOffset) {
+					break;
+				}
+				/* nameHash is written before itemOffset */
+				VM_AtomicSupport::readBarrier();
+				if ((slots[slot].nameHash == nameHash)
+					&& (itemOffset >= persistedIndex->boundaryOffset)
+					&& (itemOffset < lastOffset)
+					&& (itemOffset > nextOffset)
+				) {
+					const ShcItem* item = getIndexedItem(persistedIndex, itemOffset);
+
+					if (NULL != item) {
+						J9UTF8* className = getItemClassName(item);
+
+						if ((getIndexKeyLength(className) == keyLength) && (0 == memcmp(J9UTF8_DATA(className), key, keyLength))) {
+							nextItem = item;
+							nextOffset = itemOffset;
+						}
+					}
+				}
+				slot = (slot + 1) & mask;
+			}
+			if (NULL == nextItem) {
+				break;
+			}
+			if (!storeItem(currentThread, nextItem, persistedIndex->cachelet)) {
+				Trc_SHR_RMI_loadFromPersistedIndexes_StoreFailed(currentThread, keyLength, key, nextItem);
+				break;
+			}
+			itemsLoaded += 1;
+			lastOffset = nextOffset;
+		}
+	}
+	if (0 != itemsLoaded) {
+		Trc_SHR_RMI_loadFromPersistedIndexes_Event(currentThread, keyLength, key, itemsLoaded);
+	}
+	return itemsLoaded;
+}
+
+/* Returns the indexed item at itemOffset of a persisted index, or NULL if the entry does not lead to an indexed item */
+const ShcItem*
+SH_ROMClassManagerImpl::getIndexedItem(PersistedIndex* persistedIndex, U_32 itemOffset)
+{
+	const ShcItem* item = (const ShcItem*)(persistedIndex->cacheHeader + itemOffset);
+
+	if (!persistedIndex->cachelet->isAddressInMetaDataArea(item) || !isIndexedType(ITEMTYPE(item))) {
+		return NULL;
+	}
+	return item;
+}
+
+/**
+ * Extends the persisted index of a cache to cover the items committed since it was last updated,
+ * creating a new index if the cache has no usable index or the index is half full.
+ *
+ * Stores are batched: unless flush is true, the index is only updated once ROMCLASS_INDEX_BATCH_SIZE
+ * indexed items have been stored since the last update. Items above the index boundary are still found
+ * by the startup walk of other JVMs, so a deferred update costs them walk time but never a lookup.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cachelet The top layer of the cache
+ * @param[in] flush true to update the index for any items stored since the last update,
+ * false to count a newly stored item and update the index only if the batch is full
+ *
+ * @pre The caller must hold the cache write mutex
+ */
+void
+SH_ROMClassManagerImpl::updatePersistedIndex(J9VMThread* currentThread, SH_CompositeCache* cachelet, bool flush)
+{
+	SH_CompositeCacheImpl* cc = (SH_CompositeCacheImpl*)cachelet;
+	ROMClassIndexWrapper* index = NULL;
+	BlockPtr cacheHeader = NULL;
+	ShcItem* item = NULL;
+	U_32 boundaryOffset = 0;
+	U_32 entryCount = 0;
+
+	if ((getState() != MANAGER_STATE_STARTED)
+		|| _persistedIndexUpdateFailed
+		|| cc->isRunningReadOnly()
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlagsPtr, J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_ENABLE_NESTED)
+	) {
+		return;
+	}
+
+	if (!flush) {
+		_unindexedStores += 1;
+	}
+	if ((0 == _unindexedStores) || (!flush && (_unindexedStores < ROMCLASS_INDEX_BATCH_SIZE))) {
+		return;
+	}
+	_unindexedStores = 0;
+
+	index = cc->getROMClassIndex();
+	if (NULL == index) {
+		createPersistedIndex(currentThread, cc, NULL);
+		return;
+	}
+
+	cacheHeader = (BlockPtr)cc->getCacheHeaderAddress();
+	boundaryOffset = index->boundaryOffset;
+	entryCount = index->entryCount;
+	cc->startROMClassIndexUpdate(currentThread, index);
+	while (NULL != (item = cc->nextCommittedEntry(boundaryOffset))) {
+		U_32 itemOffset = (U_32)((BlockPtr)item - cacheHeader);
+
+		if (isIndexedType(ITEMTYPE(item))) {
+			IDATA rc = ROMCLASS_INDEX_FULL;
+
+			if (((entryCount + 1) * 2) <= index->slotCount) {
+				rc = addToPersistedIndex(currentThread, index, getItemNameHash(currentThread, item), itemOffset);
+			}
+			if (ROMCLASS_INDEX_FULL == rc) {
+				/* The entries added so far are not covered by the boundary, the new index picks them up */
+				cc->endROMClassIndexUpdate(currentThread);
+				createPersistedIndex(currentThread, cc, index);
+				return;
+			}
+			if (ROMCLASS_INDEX_ENTRY_ADDED == rc) {
+				entryCount += 1;
+			}
+		}
+		boundaryOffset = itemOffset;
+	}
+
+	if ((entryCount != index->entryCount) || (boundaryOffset != index->boundaryOffset)) {
+		/* Entries must be visible before the boundary that covers them */
+		VM_AtomicSupport::writeBarrier();
+		index->entryCount = entryCount;
+		VM_AtomicSupport::writeBarrier();
+		index->boundaryOffset = boundaryOffset;
+	}
+	cc->endROMClassIndexUpdate(currentThread);
+}
+
+/**
+ * Creates a new persisted index covering every indexed item in the cache and makes it the index of the cache.
+ * The entries of oldIndex, if any, are copied and the items committed after its boundary are added.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cachelet The top layer of the cache
+ * @param[in] oldIndex The index being replaced, or NULL
+ *
+ * @pre The caller must hold the cache write mutex
+ */
+void
+SH_ROMClassManagerImpl::createPersistedIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cachelet, ROMClassIndexWrapper* oldIndex)
+{
+	BlockPtr cacheHeader = (BlockPtr)cachelet->getCacheHeaderAddress();
+	U_32 startOffset = cachelet->getMetadataEndOffset();
+	U_32 boundaryOffset = 0;
+	UDATA entriesNeeded = 0;
+	U_32 slotCount = ROMCLASS_INDEX_MIN_SLOTS;
+	ShcItem item;
+	ShcItem* itemPtr = &item;
+	ShcItem* itemInCache = NULL;
+	ShcItem* walk = NULL;
+	ROMClassIndexWrapper* index = NULL;
+	U_32 entryCount = 0;
+
+	if (NULL != oldIndex) {
+		startOffset = oldIndex->boundaryOffset;
+		entriesNeeded = oldIndex->entryCount;
+		if (slotCount < (oldIndex->slotCount * 2)) {
+			slotCount = oldIndex->slotCount * 2;
+		}
+	}
+	walk = cachelet->nextCommittedEntry(startOffset);
+	while (NULL != walk) {
+		if (isIndexedType(ITEMTYPE(walk))) {
+			entriesNeeded += 1;
+		}
+		walk = cachelet->nextCommittedEntry((U_32)((BlockPtr)walk - cacheHeader));
+	}
+	/* Leave room for the index to grow before it is half full */
+	while ((slotCount < (entriesNeeded * 3)) && (slotCount < ROMCLASS_INDEX_MAX_SLOTS)) {
+		slotCount *= 2;
+	}
+	if ((entriesNeeded * 2) >= slotCount) {
+		Trc_SHR_RMI_createPersistedIndex_Failed(currentThread, cachelet, slotCount, entriesNeeded);
+		_persistedIndexUpdateFailed = true;
+		return;
+	}
+
+	cachelet->initBlockData(&itemPtr, (U_32)RCIWLEN(slotCount), TYPE_ROMCLASS_INDEX);
+	itemInCache = (ShcItem*)cachelet->allocateBlock(currentThread, itemPtr, SHC_WORDALIGN, 0);
+	if (NULL == itemInCache) {
+		/* Not enough space in the cache. Lookups of items not in the old index use the full walk. */
+		Trc_SHR_RMI_createPersistedIndex_Failed(currentThread, cachelet, slotCount, entriesNeeded);
+		_persistedIndexUpdateFailed = true;
+		return;
+	}
+
+	/* The new item is not committed, so it is written directly */
+	index = (ROMClassIndexWrapper*)ITEMDATA(itemInCache);
+	memset(RCIWSLOTS(index), 0, slotCount * sizeof(ROMClassIndexSlot));
+	index->version = ROMCLASS_INDEX_VERSION;
+	index->slotCount = slotCount;
+	index->crashCntr = (U_32)cachelet->getCacheHeaderAddress()->crashCntr;
+
+	if (NULL != oldIndex) {
+		ROMClassIndexSlot* oldSlots = RCIWSLOTS(oldIndex);
+		U_32 i = 0;
+
+		for (i = 0; i < oldIndex->slotCount; i++) {
+			U_32 itemOffset = oldSlots[i].itemOffset;
+
+			/* Entries below the boundary are added again by the walk below */
+			if ((itemOffset >= startOffset) && (ROMCLASS_INDEX_ENTRY_ADDED == addToPersistedIndex(currentThread, index, oldSlots[i].nameHash, itemOffset))) {
+				entryCount += 1;
+			}
+		}
+	}
+	boundaryOffset = startOffset;
+	walk = cachelet->nextCommittedEntry(startOffset);
+	while (NULL != walk) {
+		U_32 itemOffset = (U_32)((BlockPtr)walk - cacheHeader);
+
+		if (isIndexedType(ITEMTYPE(walk)) && (ROMCLASS_INDEX_ENTRY_ADDED == addToPersistedIndex(currentThread, index, getItemNameHash(currentThread, walk), itemOffset))) {
+			entryCount += 1;
+		}
+		boundaryOffset = itemOffset;
+		walk = cachelet->nextCommittedEntry(itemOffset);
+	}
+	index->entryCount = entryCount;
+	index->boundaryOffset = boundaryOffset;
+
+	cachelet->commitUpdate(currentThread, false);
+	cachelet->setROMClassIndex(currentThread, index);
+	if (NULL != oldIndex) {
+		_cache->markItemStale(currentThread, (const ShcItem*)((BlockPtr)oldIndex - sizeof(ShcItem)), false);
+	}
+	Trc_SHR_RMI_createPersistedIndex_Event(currentThread, cachelet, index, slotCount, entryCount, boundaryOffset);
+}
+
+/**
+ * Adds an entry for an item to a persisted index.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] index The index, which must be writable, see SH_CompositeCacheImpl::startROMClassIndexUpdate()
+ * @param[in] nameHash Hash of the hashtable key of the item, see getItemNameHash()
+ * @param[in] itemOffset Offset of the item from the cache header
+ *
+ * @return ROMCLASS_INDEX_ENTRY_ADDED, ROMCLASS_INDEX_ENTRY_EXISTS if the item is already in the index
+ * or ROMCLASS_INDEX_FULL if there is no free slot
+ */
+IDATA
+SH_ROMClassManagerImpl::addToPersistedIndex(J9VMThread* currentThread, ROMClassIndexWrapper* index, U_32 nameHash, U_32 itemOffset)
+{
+	ROMClassIndexSlot* slots = RCIWSLOTS(index);
+	U_32 mask = index->slotCount - 1;
+	U_32 slot = nameHash & mask;
+	U_32 probes = 0;
+
+	for (probes = 0; probes <= mask; probes++) {
+		if (0 == slots[slot].itemOffset) {
+			/* A JVM searching the index concurrently must never find an itemOffset without its nameHash */
+			slots[slot].nameHash = nameHash;
+			VM_AtomicSupport::writeBarrier();
+			slots[slot].itemOffset = itemOffset;
+			return ROMCLASS_INDEX_ENTRY_ADDED;
+		}
+		if (itemOffset == slots[slot].itemOffset) {
+			/* Added by a JVM which did not get to update the boundary */
+			return ROMCLASS_INDEX_ENTRY_EXISTS;
+		}
+		slot = (slot + 1) & mask;
+	}
+	return ROMCLASS_INDEX_FULL;
+}
+
+/* Returns the class name of a ROMClass, scoped ROMClass or orphan item */
+J9UTF8*
+SH_ROMClassManagerImpl::getItemClassName(const ShcItem* item)
+{
+	J9ROMClass* romClass = NULL;
+
+	if (TYPE_ORPHAN == ITEMTYPE(item)) {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(item))->romClassOffset));
+	} else {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(item))->romClassOffset));
+	}
+	return J9ROMCLASS_CLASSNAME(romClass);
+}
+
+/* Returns the length of the hashtable key for a class name. As in HashLinkedListImpl::initialize(),
+ * the key of a lambda class name stops before the index number. */
+U_16
+SH_ROMClassManagerImpl::getIndexKeyLength(const J9UTF8* className)
+{
+	const char* name = (const char*)J9UTF8_DATA(className);
+	U_16 keyLength = J9UTF8_LENGTH(className);
+	char* end = getLastDollarSignOfLambdaClassName(name, keyLength);
+
+	if (NULL != end) {
+		keyLength = (U_16)(end - name + 1);
+	}
+	return keyLength;
+}
+
+U_32
+SH_ROMClassManagerImpl::hashIndexKey(J9VMThread* currentThread, const U_8* key, U_16 keyLength)
+{
+	return (U_32)currentThread->javaVM->internalVMFunctions->computeHashForUTF8(key, keyLength);
+}
+
+U_32
+SH_ROMClassManagerImpl::getItemNameHash(J9VMThread* currentThread, const ShcItem* item)
+{
+	J9UTF8* className = getItemClassName(item);
+
+	return hashIndexKey(currentThread, J9UTF8_DATA(className), getIndexKeyLength(className));
+}
+
+bool
+SH_ROMClassManagerImpl::isIndexedType(UDATA itemType)
+{
+	return (TYPE_ROMCLASS == itemType) || (TYPE_SCOPED_ROMCLASS == itemType) || (TYPE_ORPHAN == itemType);
+}
+
+/**
+ * @see SH_Manager::getNumItems()
+ *
+ * Also counts the indexed items which have not yet been loaded into the local hashtable.
+ *
+ * @param currentThread - the currentThread or NULL when called to collect javacore data
+ */
+void
+SH_ROMClassManagerImpl::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems)
+{
+	UDATA i = 0;
+
+	SH_Manager::getNumItems(currentThread, nonStaleItems, staleItems);
+
+	if (_persistedIndexesInUse && lockHashTable(currentThread, "getNumItems")) {
+		for (i = 0; i < _persistedIndexCount; i++) {
+			PersistedIndex* persistedIndex = &_persistedIndexes[i];
+			ROMClassIndexWrapper* index = persistedIndex->index;
+			ROMClassIndexSlot* slots = NULL;
+			U_32 slot = 0;
+
+			if (NULL == index) {
+				continue;
+			}
+			slots = RCIWSLOTS(index);
+			for (slot = 0; slot < index->slotCount; slot++) {
+				U_32 itemOffset = slots[slot].itemOffset;
+
+				if ((0 != itemOffset) && (itemOffset >= persistedIndex->boundaryOffset)) {
+					const ShcItem* item = getIndexedItem(persistedIndex, itemOffset);
+
+					if (NULL != item) {
+						J9UTF8* className = getItemClassName(item);
+
+						if (NULL == hllTableLookupHelper(currentThread, J9UTF8_DATA(className), getIndexKeyLength(className), 0, NULL)) {
+							if (_cache->isStale(item)) {
+								*staleItems += 1;
+							} else {
+								*nonStaleItems += 1;
+							}
+						}
+					}
+				}
+			}
+		}
+		unlockHashTable(currentThread, "getNumItems");
+	}
+}
+
 UDATA
 SH_ROMClassManagerImpl::customCountItemsInList(void* entry, void* opaque)
 {
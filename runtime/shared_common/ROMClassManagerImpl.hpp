@@ -33,6 +33,9 @@
 #include "TimestampManager.hpp"
 #include "j9.h"
 #include "j9protos.h"
+#include "shchelp.h"
+
+class SH_CompositeCacheImpl;
 
 /**
  * Implementation of SH_ROMClassManager
@@ -44,6 +47,13 @@
  * is a linked list of ROMClasses that have the same name, but different or unknown classpaths.
  * 
  * Multiple class names may have the same hint value.
+ *
+ * Each cache layer may also hold a persisted index of its ROMClass items (see ROMClassIndexWrapper).
+ * Items covered by the index are not added to the HLL table when the cache is read. Instead, all the
+ * items for a class name are loaded from the index the first time the name is looked up, so the
+ * HLL table always holds either all or none of the items for a name.
+ * The index is extended in batches as classes are stored and at the end of startup, items stored since
+ * the last update are added to the HLL table by the walk when the cache is read.
  * 
  * @ingroup Shared_Common
  */
@@ -67,6 +77,10 @@ public:
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen);
 
+	virtual void updatePersistedIndex(J9VMThread* currentThread, SH_CompositeCache* cachelet, bool flush);
+
+	virtual void getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
+
 	void runExitCode(void) {};	
 
 protected:
@@ -95,6 +109,14 @@ protected:
 #endif
 	
 private:
+	/* The persisted index of a cache layer, as found when the layer was first read */
+	struct PersistedIndex {
+		SH_CompositeCacheImpl* cachelet;
+		ROMClassIndexWrapper* index;	/* NULL if the layer has no usable index */
+		BlockPtr cacheHeader;
+		U_32 boundaryOffset;
+	};
+
 	SH_TimestampManager* _tsm;
 	
 	/**
@@ -111,6 +133,38 @@ private:
 	 */
 	J9Pool* _linkedListImplPool;
 
+	PersistedIndex _persistedIndexes[J9SH_LAYER_NUM_MAX_VALUE + 1];
+	UDATA _persistedIndexCount;
+	bool _persistedIndexesInUse;
+	bool _persistedIndexUpdateFailed;
+	UDATA _unindexedStores;
+
+	bool storeItem(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet);
+
+	HashLinkedListImpl* lookupClass(J9VMThread* currentThread, const char* name, U_16 nameLen);
+
+	PersistedIndex* getPersistedIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cachelet);
+
+	UDATA loadFromPersistedIndexes(J9VMThread* currentThread, const U_8* key, U_16 keyLength, UDATA firstLayer, UDATA endLayer);
+
+	const ShcItem* getIndexedItem(PersistedIndex* persistedIndex, U_32 itemOffset);
+
+	void createPersistedIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cachelet, ROMClassIndexWrapper* oldIndex);
+
+	IDATA addToPersistedIndex(J9VMThread* currentThread, ROMClassIndexWrapper* index, U_32 nameHash, U_32 itemOffset);
+
+	J9UTF8* getItemClassName(const ShcItem* item);
+
+	U_32 getItemNameHash(J9VMThread* currentThread, const ShcItem* item);
+
+	static U_16 getIndexKeyLength(const J9UTF8* className);
+
+	static U_32 hashIndexKey(J9VMThread* currentThread, const U_8* key, U_16 keyLength);
+
+	static bool isIndexedType(UDATA itemType);
+
+	static UDATA loadForExistingKeyDoFn(void* entry, void* userData);
+
 
 	bool checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* wrapper, const ShcItem* item);
 
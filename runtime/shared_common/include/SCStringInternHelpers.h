@@ -25,6 +25,7 @@
 
 #include "j9.h"
 #include "srphashtable_api.h"
+#include "util_api.h"
 
 
 /* Query struct for searching the shared string intern srp hash table. */
@@ -115,12 +116,7 @@ sharedInternHashFn(void *key, void *userData)
 	length = query->length;
 	data = query->data;
 
-	UDATA hash = 0;
-	for (UDATA i = 0; i < length; i++) {
-		hash = (hash << 5) - hash + data[i];
-	}
-
-	return hash;
+	return computeHashForBytes(0, data, length);
 }
 
 
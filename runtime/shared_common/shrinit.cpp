@@ -267,6 +267,7 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_NO_TIMESTAMP_CHECKS, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_TIMESTAMP_CHECKS_V1, 0, 0},
 	{OPTION_NO_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_URL_TIMESTAMP_CHECK},
 	{OPTION_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_URL_TIMESTAMP_CHECK},
+	{HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS},
 	{OPTION_NO_CLASSPATH_CACHEING, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_CLASSPATH_CACHEING},
 	{OPTION_NO_REDUCE_STORE_CONTENTION, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_REDUCE_STORE_CONTENTION},
 	{OPTION_NO_ROUND_PAGES, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_ROUND_PAGES},
@@ -384,6 +385,7 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_FIND_AOT_METHODS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_FIND_AOT_METHODS_EQUALS, J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE},
 	{ OPTION_NO_URL_TIMESTAMP_CHECK, PARSE_TYPE_EXACT, RESULT_DO_REMOVE_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ENABLE_URL_TIMESTAMP_CHECK},
 	{ OPTION_URL_TIMESTAMP_CHECK, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ENABLE_URL_TIMESTAMP_CHECK},
+	{ OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0},
 #if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
 	{ OPTION_LAYER_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_LAYER_EQUALS, 0 },
 	{ OPTION_CREATE_LAYER, PARSE_TYPE_EXACT, RESULT_DO_CREATE_LAYER, 0 },
@@ -404,6 +406,7 @@ static BOOLEAN verifyStringTableElement(void *address, void *userData);
 bool modifyCacheName(J9JavaVM *vm, const char* origName, UDATA verboseFlags, char** modifiedCacheName, UDATA bufLen);
 static BOOLEAN j9shr_parseMemSize(char * str, UDATA & value);
 static void addTestJitHint(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+static void hookFlushPersistedROMClassIndex(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
 static IDATA j9shr_restoreFromSnapshot(J9JavaVM* vm, const char* ctrlDirName, const char* cacheName, bool* cacheExist);
 static void j9shr_print_snapshot_filename(J9JavaVM* vm, const char* cacheDirName, const char* snapshotName, I_8 layer);
 static IDATA j9shr_aotMethodOperation(J9JavaVM* vm, char* methodSpecs, UDATA action);
@@ -700,6 +703,20 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			options += strlen(OPTION_LAYER_EQUALS)+ (cursor - layerString) +1;
 			continue;
 		}
+		case RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS:
+		{
+			UDATA temp = 0;
+			char* intervalString = options + strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+			char* cursor = intervalString;
+			if (scan_udata(&cursor, &temp) == 0) {
+				vm->sharedCacheAPI->timestampCheckInterval = temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_TIMESTAMP_CHECK_INTERVAL, options);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS) + (cursor - intervalString) + 1;
+			continue;
+		}
 		case RESULT_DO_CREATE_LAYER:
 		{
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
@@ -1703,6 +1720,32 @@ hookSerializeSharedCache(J9HookInterface** hookInterface, UDATA eventNum, void*
 
 #endif /* J9SHR_CACHELET_SUPPORT */
 
+/**
+ * Add the classes stored since the last batch to the persisted ROMClass index before the JVM shuts down,
+ * so that the index of a JVM that exits during startup is complete.
+ * The hook runs without VM access, so a thread holding the cache write mutex can always release it.
+ *
+ * @param [in] hookInterface  Pointer to pointer to the hook interface structure
+ * @param [in] eventNum  Not used
+ * @param [in] voidData  Pointer to a J9VMShutdownEvent struct
+ * @param [in] userData  Not used
+ */
+static void
+hookFlushPersistedROMClassIndex(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData)
+{
+	J9VMShutdownEvent* eventData = (J9VMShutdownEvent*)voidData;
+	J9VMThread* currentThread = eventData->vmThread;
+	J9SharedClassConfig* sharedClassConfig = currentThread->javaVM->sharedClassConfig;
+
+	if ((NULL != sharedClassConfig)
+		&& (NULL != sharedClassConfig->sharedClassCache)
+		&& J9_ARE_ALL_BITS_SET(sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_CACHE_INITIALIZATION_COMPLETE)
+		&& J9_ARE_NO_BITS_SET(sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_DENY_CACHE_ACCESS | J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES)
+	) {
+		((SH_CacheMap*)sharedClassConfig->sharedClassCache)->flushPersistedROMClassIndex(currentThread);
+	}
+}
+
 /**
  * Store compiled method in shared classes cache
  *
@@ -2044,13 +2087,17 @@ j9shr_storeAttachedData(J9VMThread* currentThread, const void* addressInCache, c
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localRuntimeFlags & J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL) {
+	/* Verified class records are stored in the block data area rather than the JIT data area */
+	if ((localRuntimeFlags & J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data->type)
+	) {
 		Trc_SHR_INIT_storeAttachedData_exit_CacheFull(currentThread);
 		return J9SHR_RESOURCE_STORE_FULL;
 	}
 
 	if ((J9SHR_ATTACHED_DATA_TYPE_JITPROFILE != data->type)
-		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)) {
+		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFIED != data->type)) {
 		Trc_SHR_INIT_storeAttachedData_exit_TypeUnknown(currentThread, data->type);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
 	}
@@ -3583,6 +3630,7 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 
 		/* Register hooks */
 		(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_FIND_LOCALLY_DEFINED_CLASS, hookFindSharedClass, OMR_GET_CALLSITE(), NULL);
+		(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_SHUTTING_DOWN, hookFlushPersistedROMClassIndex, OMR_GET_CALLSITE(), NULL);
 
 #if defined(J9SHR_CACHELET_SUPPORT)
 		if (runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED) {
@@ -4167,6 +4215,7 @@ j9shr_guaranteed_exit(J9JavaVM *vm, BOOLEAN exitForDebug)
 			 */
 			J9HookInterface** hook = vm->internalVMFunctions->getVMHookInterface(vm);
 			(*hook)->J9HookUnregister(hook, J9HOOK_VM_FIND_LOCALLY_DEFINED_CLASS, hookFindSharedClass, NULL);
+			(*hook)->J9HookUnregister(hook, J9HOOK_VM_SHUTTING_DOWN, hookFlushPersistedROMClassIndex, NULL);
 
 #if defined(J9SHR_CACHELET_SUPPORT)
 			if (vm->sharedClassConfig->runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED) {
@@ -5013,6 +5062,8 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 		/* OpenJ9 issue; https://github.com/eclipse/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
 		storeStartupHintsToSharedCache(currentThread);
+		/* Classes stored during startup are added to the persisted ROMClass index in one batch */
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->flushPersistedROMClassIndex(currentThread);
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
@@ -635,7 +635,7 @@ validateLocalSlot(J9VMThread *currentThread, J9Method *ramMethod, U_32 offsetPC,
 			}
 			values = variableInfoNextDo(&state);
 		}
-		releaseOptInfoBuffer(vm, romClass);
+		releaseMethodDebugInfo(vm, romClass, methodDebugInfo);
 	}
 #endif
 
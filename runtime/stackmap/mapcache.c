@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9protos.h"
+#include "hashtable_api.h"
+#include "stackmap_api.h"
+#include "ut_map.h"
+
+/*
+ * Cache of local and stack maps computed for interpreted frames.
+ *
+ * Computing a map runs a dataflow pass over the bytecodes of the method, which is repeated
+ * for every frame of the method found by every GC or exception stack walk. Maps of up to 32
+ * slots fit in a single U_32 and are remembered here, keyed by the address of the bytecode
+ * the frame is stopped at and the number of slots mapped.
+ *
+ * The tables hang off the class loader which owns the ROM class, so the keys remain valid
+ * until the tables are freed along with the loader. Anonymous and hidden classes report their
+ * host loader as their classLoader, but their ROM classes live in the anonymous class loader and
+ * are unloaded individually, so callers pass a NULL loader for them and they are never cached.
+ */
+
+typedef struct J9MapCacheEntry {
+	U_8 *bytecodePC;
+	UDATA slotCount;
+	U_32 bits;
+} J9MapCacheEntry;
+
+static UDATA mapCacheHash(void *entry, void *userData);
+static UDATA mapCacheEquals(void *leftEntry, void *rightEntry, void *userData);
+static IDATA cachedBitsForPC(J9JavaVM *vm, J9HashTable **cache, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount, BOOLEAN isLocalMap);
+
+
+static UDATA
+mapCacheHash(void *entry, void *userData)
+{
+	J9MapCacheEntry *mapEntry = (J9MapCacheEntry *) entry;
+
+	return ((UDATA) mapEntry->bytecodePC * 31) + mapEntry->slotCount;
+}
+
+
+static UDATA
+mapCacheEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	J9MapCacheEntry *left = (J9MapCacheEntry *) leftEntry;
+	J9MapCacheEntry *right = (J9MapCacheEntry *) rightEntry;
+
+	return (left->bytecodePC == right->bytecodePC) && (left->slotCount == right->slotCount);
+}
+
+
+/*
+ * Look the map up in the cache, computing and adding it on a miss.
+ * The mapping itself is done outside of mapCacheMutex as it may need the global map memory buffer.
+ */
+static IDATA
+cachedBitsForPC(J9JavaVM *vm, J9HashTable **cache, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount, BOOLEAN isLocalMap)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9MapCacheEntry exemplar;
+	J9MapCacheEntry *entry = NULL;
+	IDATA rc = 0;
+
+	exemplar.bytecodePC = J9_BYTECODE_START_FROM_ROM_METHOD(romMethod) + pc;
+	exemplar.slotCount = slotCount;
+	exemplar.bits = 0;
+
+	omrthread_monitor_enter(vm->mapCacheMutex);
+	if (NULL != *cache) {
+		entry = hashTableFind(*cache, &exemplar);
+	}
+	if (NULL != entry) {
+		*resultArrayBase = entry->bits;
+		vm->mapCacheHits += 1;
+		omrthread_monitor_exit(vm->mapCacheMutex);
+		return 0;
+	}
+	vm->mapCacheMisses += 1;
+	omrthread_monitor_exit(vm->mapCacheMutex);
+
+	if (isLocalMap) {
+		rc = vm->localMapFunction(PORTLIB, romClass, romMethod, pc, resultArrayBase, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	} else {
+		rc = j9stackmap_StackBitsForPC(PORTLIB, pc, romClass, romMethod, resultArrayBase, slotCount, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	}
+
+	if (rc >= 0) {
+		exemplar.bits = *resultArrayBase;
+
+		omrthread_monitor_enter(vm->mapCacheMutex);
+		if (NULL == *cache) {
+			*cache = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0, sizeof(J9MapCacheEntry), 0, 0, OMRMEM_CATEGORY_VM, mapCacheHash, mapCacheEquals, NULL, NULL);
+			if (NULL == *cache) {
+				Trc_Map_j9mapcache_AllocationFailure();
+			}
+		}
+		if (NULL != *cache) {
+			if (hashTableGetCount(*cache) < MAP_CACHE_MAX_ENTRIES) {
+				/* Another thread may have added the same map in the meantime, in which case the add returns the existing entry */
+				hashTableAdd(*cache, &exemplar);
+			} else {
+				Trc_Map_j9mapcache_CacheFull(isLocalMap, MAP_CACHE_MAX_ENTRIES);
+			}
+		}
+		omrthread_monitor_exit(vm->mapCacheMutex);
+	}
+
+	return rc;
+}
+
+
+IDATA
+j9mapcache_LocalBitsForPC(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount)
+{
+	/* Maps produced by the debug local mapper depend on the debug capabilities, so they are never cached */
+	if ((slotCount > 32)
+		|| (NULL == vm->mapCacheMutex)
+		|| (NULL == classLoader)
+		|| (vm->localMapFunction != j9localmap_LocalBitsForPC)
+	) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		return vm->localMapFunction(PORTLIB, romClass, romMethod, pc, resultArrayBase, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	}
+
+	return cachedBitsForPC(vm, &classLoader->localMapCache, romClass, romMethod, pc, resultArrayBase, slotCount, TRUE);
+}
+
+
+IDATA
+j9mapcache_StackBitsForPC(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA slotCount)
+{
+	if ((slotCount > 32)
+		|| (NULL == vm->mapCacheMutex)
+		|| (NULL == classLoader)
+	) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		return j9stackmap_StackBitsForPC(PORTLIB, pc, romClass, romMethod, resultArrayBase, slotCount, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	}
+
+	return cachedBitsForPC(vm, &classLoader->stackMapCache, romClass, romMethod, pc, resultArrayBase, slotCount, FALSE);
+}
+
@@ -24,6 +24,7 @@ omr_add_exports(j9ben
 	JNI_OnLoad
 	JNI_OnUnload
 	Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest
+	Java_j9vm_test_jni_GlobalRefReuseTest_globalRefReuseTest
 	Java_jvmti_test_nativeMethodPrefixes_UnwrappedNative_nat
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
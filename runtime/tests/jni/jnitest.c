@@ -74,6 +74,65 @@ Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest(JNIEnv *env, jclass
 	return rc;
 }
 
+/* Deleting a global ref twice must not let two later refs share one slot */
+static jboolean
+globalRefReuseTest(JNIEnv *env, jobject first, jobject second, jboolean isWeak)
+{
+	jobject refs[40];
+	jobject deleted = NULL;
+	jboolean rc = JNI_TRUE;
+	jint i = 0;
+
+	deleted = isWeak ? (*env)->NewWeakGlobalRef(env, first) : (*env)->NewGlobalRef(env, first);
+	if (NULL == deleted) {
+		return JNI_FALSE;
+	}
+	if (isWeak) {
+		(*env)->DeleteWeakGlobalRef(env, deleted);
+		(*env)->DeleteWeakGlobalRef(env, deleted);
+	} else {
+		(*env)->DeleteGlobalRef(env, deleted);
+		(*env)->DeleteGlobalRef(env, deleted);
+	}
+
+	/* Create more refs than a thread caches, alternating the two objects */
+	for (i = 0; i < 40; i++) {
+		jobject target = (0 == (i & 1)) ? first : second;
+		refs[i] = isWeak ? (*env)->NewWeakGlobalRef(env, target) : (*env)->NewGlobalRef(env, target);
+		if (NULL == refs[i]) {
+			return JNI_FALSE;
+		}
+	}
+	for (i = 0; i < 40; i++) {
+		jobject target = (0 == (i & 1)) ? first : second;
+		jint j = 0;
+		for (j = 0; j < i; j++) {
+			if (refs[i] == refs[j]) {
+				rc = JNI_FALSE;
+			}
+		}
+		if (!(*env)->IsSameObject(env, refs[i], target)) {
+			rc = JNI_FALSE;
+		}
+	}
+	for (i = 0; i < 40; i++) {
+		if (isWeak) {
+			(*env)->DeleteWeakGlobalRef(env, refs[i]);
+		} else {
+			(*env)->DeleteGlobalRef(env, refs[i]);
+		}
+	}
+
+	return rc;
+}
+
+jboolean JNICALL
+Java_j9vm_test_jni_GlobalRefReuseTest_globalRefReuseTest(JNIEnv *env, jclass clazz, jobject first, jobject second)
+{
+	return globalRefReuseTest(env, first, second, JNI_FALSE)
+		&& globalRefReuseTest(env, first, second, JNI_TRUE);
+}
+
 jint JNICALL
 Java_jvmti_test_nativeMethodPrefixes_UnwrappedNative_nat(JNIEnv *env, jclass clazz)
 {
@@ -158,6 +158,7 @@ omr_add_exports(jvmtitest
 	Java_com_ibm_jvmti_tests_vmDump_vmd001_tryDisableVmDump
 	Java_com_ibm_jvmti_tests_getLoadedClasses_glc001_check
 	Java_com_ibm_jvmti_tests_retransformClasses_rtc001_retransformClass
+	Java_com_ibm_jvmti_tests_compressedDebugInfo_cdi001_getLineNumbers
 	Java_com_ibm_jvmti_tests_log_log001_tryQueryLogOptions
 	Java_com_ibm_jvmti_tests_log_log001_trySetLogOptions
 	Java_com_ibm_jvmti_tests_javaLockMonitoring_jlm001_jvmtiJlmSet
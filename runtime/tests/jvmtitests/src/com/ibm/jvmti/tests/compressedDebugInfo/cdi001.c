@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include <string.h>
+
+#include "jvmti_test.h"
+
+static agentEnv * env;
+
+
+jint JNICALL
+cdi001(agentEnv * agent_env, char * args)
+{
+	jvmtiError err;
+	jvmtiCapabilities capabilities;
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+
+	env = agent_env;
+
+	/* Do not ask for can_retransform_classes, it keeps the debug info of all classes inline */
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_get_line_numbers = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to AddCapabilities");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+jintArray JNICALL
+Java_com_ibm_jvmti_tests_compressedDebugInfo_cdi001_getLineNumbers(JNIEnv * jni_env, jclass klass, jobject method)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jvmtiError err;
+	jmethodID mid;
+	jint entryCount = 0;
+	jvmtiLineNumberEntry * table = NULL;
+	jintArray lineNumbers;
+	jint i;
+
+	mid = (*jni_env)->FromReflectedMethod(jni_env, method);
+	if (NULL == mid) {
+		error(env, JVMTI_ERROR_INVALID_METHODID, "FromReflectedMethod failed");
+		return NULL;
+	}
+
+	err = (*jvmti_env)->GetLineNumberTable(jvmti_env, mid, &entryCount, &table);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "GetLineNumberTable failed");
+		return NULL;
+	}
+
+	lineNumbers = (*jni_env)->NewIntArray(jni_env, entryCount);
+	if (NULL != lineNumbers) {
+		for (i = 0; i < entryCount; i++) {
+			(*jni_env)->SetIntArrayRegion(jni_env, lineNumbers, i, 1, &table[i].line_number);
+		}
+	}
+
+	err = (*jvmti_env)->Deallocate(jvmti_env, (unsigned char *) table);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Deallocate failed");
+		return NULL;
+	}
+
+	return lineNumbers;
+}
@@ -49,6 +49,33 @@
 /* Static J9ITable used as a non-NULL iTable cache value by classes that don't implement any interfaces */
 const J9ITable invalidITable = { (J9Class *) (UDATA) 0xDEADBEEF, 0, (J9ITable *) NULL };
 
+/* Static interface dispatch table shared by classes which have no dispatch table of their own */
+J9ITable * const invalidITableDispatch[J9_ITABLE_DISPATCH_SIZE] = {
+	(J9ITable *) &invalidITable, (J9ITable *) &invalidITable, (J9ITable *) &invalidITable, (J9ITable *) &invalidITable,
+	(J9ITable *) &invalidITable, (J9ITable *) &invalidITable, (J9ITable *) &invalidITable, (J9ITable *) &invalidITable
+};
+
+void
+initializeITableDispatch(J9Class * clazz)
+{
+	J9ITable * iTable = (J9ITable *) clazz->iTable;
+	UDATA i = 0;
+
+	if ((J9ITable **) invalidITableDispatch == clazz->iTableDispatch) {
+		return;
+	}
+	for (i = 0; i < J9_ITABLE_DISPATCH_SIZE; i++) {
+		clazz->iTableDispatch[i] = (J9ITable *) &invalidITable;
+	}
+	while (NULL != iTable) {
+		J9ITable ** slot = &J9_ITABLE_DISPATCH_PROBE(clazz, iTable->interfaceClass);
+		if (&invalidITable == *slot) {
+			*slot = iTable;
+		}
+		iTable = iTable->next;
+	}
+}
+
 #if defined(J9VM_INTERP_HOT_CODE_REPLACEMENT)
 
 #define GET_SUPERCLASS(clazz) \
@@ -1142,6 +1169,9 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 			}
 		}
 
+		/* Rebuild the dispatch table from the fixed iTable list */
+		initializeITableDispatch(clazz);
+
 		classPair = hashTableNextDo(&hashTableState);
 	}
 
@@ -1169,6 +1199,8 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 	while (clazz != NULL) {
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
 			clazz->iTable = J9_CURRENT_CLASS(clazz)->iTable;
+			clazz->iTableDispatch = J9_CURRENT_CLASS(clazz)->iTableDispatch;
+			clazz->lastITable = (J9ITable *) &invalidITable;
 		}
 		clazz = vmFuncs->allClassesNextDo(&classWalkState);
 	}
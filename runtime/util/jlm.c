@@ -117,7 +117,30 @@
 #define JLM_DUMP_FORMAT_SIZE       8
 /* version */
 #define JLM_DUMP_VERSION           1
-
+/* 4 monitors + 4 enter + 4 slow + 4 recursive + 4 spin2 + 4 yield + 4 spin acquired + 4 spin blocked + 4 yield limit + 8 hold time = 44 */
+#define JLM_DUMP_CLASS_FIELD_SIZE 44
+
+#if defined(OMR_THR_JLM)
+/* Lock statistics of all traced object monitors whose objects are instances of clazz */
+typedef struct JlmClassLockStats {
+	J9Class *clazz;
+	UDATA monitorCount;
+	UDATA enterCount;
+	UDATA slowCount;
+	UDATA recursiveCount;
+	UDATA spin2Count;
+	UDATA yieldCount;
+	UDATA spinAcquireCount;
+	UDATA spinBlockCount;
+	UDATA yieldLimitSum;
+	U_64 holdTime;
+} JlmClassLockStats;
+
+static J9HashTable * CollectClassLockStats (J9VMThread *vmThread);
+static UDATA ClassLockStatsHash (void *entry, void *userData);
+static UDATA ClassLockStatsEquals (void *left, void *right, void *userData);
+static void GetClassName (J9VMThread *vmThread, J9Class *clazz, char *nameBuf);
+#endif /* defined(OMR_THR_JLM) */
 
 static void GetMonitorName (J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nameBuf);
 
@@ -153,6 +176,38 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 		WRITE_4BYTES(dump_format);
 	}
 
+	if (dump_format == COM_IBM_JLM_DUMP_FORMAT_CLASS_STATS) {
+		J9HashTable *classStats = CollectClassLockStats(vmThread);
+		J9HashTableState hashTableState;
+		JlmClassLockStats *stats = NULL;
+
+		if (NULL == classStats) {
+			return (jint) JLM_OUT_OF_MEMORY;
+		}
+		stats = hashTableStartDo(classStats, &hashTableState);
+		while (NULL != stats) {
+			WRITE_4BYTES(stats->monitorCount);
+			WRITE_4BYTES(stats->enterCount);
+			WRITE_4BYTES(stats->slowCount);
+			WRITE_4BYTES(stats->recursiveCount);
+			WRITE_4BYTES(stats->spin2Count);
+			WRITE_4BYTES(stats->yieldCount);
+			WRITE_4BYTES(stats->spinAcquireCount);
+			WRITE_4BYTES(stats->spinBlockCount);
+			/* average adaptive yield limit of the monitors of this class */
+			WRITE_4BYTES(stats->yieldLimitSum / stats->monitorCount);
+			WRITE_8BYTES(stats->holdTime);
+
+			GetClassName(vmThread, stats->clazz, monitor_name);
+			strcpy(dump, monitor_name);
+			dump += strlen((const char *)dump) + 1;
+
+			stats = hashTableNextDo(&hashTableState);
+		}
+		hashTableFree(classStats);
+		return (jint) JLM_SUCCESS;
+	}
+
 	monitor = NULL;
 	/* walk all the monitors to copy data into monitor_dump data */
 	omrthread_monitor_init_walk(&walkState);
@@ -308,6 +363,136 @@ JlmStopTimeStamps(void)
 
 
 
+#if defined(OMR_THR_JLM)
+/**
+ * Sum the JLM and adaptive spinning statistics of all traced object monitors by the class of the locked object.
+ * Assumes exclusive VM access, so the monitor tables can be walked without the monitor table mutex.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @returns a hash table of JlmClassLockStats which the caller must free, or NULL if out of memory
+ */
+static J9HashTable *
+CollectClassLockStats(J9VMThread *vmThread)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	UDATA tableIndex = 0;
+	J9HashTable *classStats = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	classStats = hashTableNew(
+			OMRPORT_FROM_J9PORT(PORTLIB),
+			J9_GET_CALLSITE(),
+			0,
+			sizeof(JlmClassLockStats),
+			sizeof(J9Class *),
+			0,
+			OMRMEM_CATEGORY_VM,
+			ClassLockStatsHash,
+			ClassLockStatsEquals,
+			NULL,
+			NULL);
+	if (NULL == classStats) {
+		return NULL;
+	}
+
+	for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+		J9HashTable *monitorTable = vm->monitorTables[tableIndex];
+		if (NULL != monitorTable) {
+			J9HashTableState walkState;
+			J9ObjectMonitor *objectMonitor = hashTableStartDo(monitorTable, &walkState);
+			while (NULL != objectMonitor) {
+				J9ThreadAbstractMonitor *monitor = (J9ThreadAbstractMonitor *)objectMonitor->monitor;
+				J9ThreadMonitorTracing *tracing = monitor->tracing;
+				j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &monitor->userData);
+
+				if ((NULL != tracing) && (NULL != object)) {
+					JlmClassLockStats entry;
+					JlmClassLockStats *stats = NULL;
+
+					memset(&entry, 0, sizeof(entry));
+					entry.clazz = J9OBJECT_CLAZZ(vmThread, object);
+					/* hashTableAdd returns the existing entry if the class has already been seen */
+					stats = hashTableAdd(classStats, &entry);
+					if (NULL == stats) {
+						hashTableFree(classStats);
+						return NULL;
+					}
+					stats->monitorCount += 1;
+					stats->enterCount += tracing->enter_count;
+					stats->slowCount += tracing->slow_count;
+					stats->recursiveCount += tracing->recursive_count;
+					stats->spin2Count += tracing->spin2_count;
+					stats->yieldCount += tracing->yield_count;
+					stats->spinAcquireCount += objectMonitor->spinAcquireCount;
+					stats->spinBlockCount += objectMonitor->spinBlockCount;
+					stats->yieldLimitSum += J9_OBJECT_MONITOR_ADAPTIVE_YIELD_LIMIT(objectMonitor->spinYieldAverage);
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+					stats->holdTime += tracing->holdtime_sum;
+#endif /* defined(OMR_THR_JLM_HOLD_TIMES) */
+				}
+				objectMonitor = hashTableNextDo(&walkState);
+			}
+		}
+	}
+	return classStats;
+}
+
+static UDATA
+ClassLockStatsHash(void *entry, void *userData)
+{
+	return (UDATA)((JlmClassLockStats *)entry)->clazz / sizeof(J9Class *);
+}
+
+static UDATA
+ClassLockStatsEquals(void *left, void *right, void *userData)
+{
+	return ((JlmClassLockStats *)left)->clazz == ((JlmClassLockStats *)right)->clazz;
+}
+
+/**
+ * Write the name of a class, in signature form for arrays, truncated to OBJ_MON_NAME_CLASS_NAME_SIZE.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] clazz the class
+ * @param[out] nameBuf a buffer of at least OBJ_MON_NAME_BUF_SIZE bytes
+ */
+static void
+GetClassName(J9VMThread *vmThread, J9Class *clazz, char *nameBuf)
+{
+	PORT_ACCESS_FROM_VMC(vmThread);
+	J9ROMClass *romClass = clazz->romClass;
+
+	if (J9ROMCLASS_IS_ARRAY(romClass)) {
+		J9ArrayClass *arrayClass = (J9ArrayClass *)clazz;
+		J9Class *leafType = arrayClass->leafComponentType;
+		UDATA arity = arrayClass->arity;
+		char *cursor = nameBuf;
+
+		if (arity > OBJ_MON_NAME_CLASS_NAME_SIZE) {
+			arity = OBJ_MON_NAME_CLASS_NAME_SIZE;
+		}
+		memset(cursor, '[', arity);
+		cursor += arity;
+		if (J9ROMCLASS_IS_PRIMITIVE_TYPE(leafType->romClass)) {
+			*cursor++ = J9UTF8_DATA(J9ROMCLASS_CLASSNAME(leafType->arrayClass->romClass))[1];
+			*cursor = '\0';
+		} else {
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(leafType->romClass);
+			UDATA length = J9UTF8_LENGTH(className);
+			j9str_printf(PORTLIB, cursor, OBJ_MON_NAME_BUF_SIZE - arity, "L%.*s;",
+					(length < OBJ_MON_NAME_CLASS_NAME_SIZE) ? length : OBJ_MON_NAME_CLASS_NAME_SIZE,
+					J9UTF8_DATA(className));
+		}
+	} else {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+		UDATA length = J9UTF8_LENGTH(className);
+		j9str_printf(PORTLIB, nameBuf, OBJ_MON_NAME_BUF_SIZE, "%.*s",
+				(length < OBJ_MON_NAME_CLASS_NAME_SIZE) ? length : OBJ_MON_NAME_CLASS_NAME_SIZE,
+				J9UTF8_DATA(className));
+	}
+}
+#endif /* defined(OMR_THR_JLM) */
+
 static void 
 GetMonitorName(J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nameBuf)
 {
@@ -415,6 +600,24 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 		objIDfieldSize = sizeof(void *);
 	}
 
+	if (dump_format == COM_IBM_JLM_DUMP_FORMAT_CLASS_STATS) {
+		J9HashTable *classStats = CollectClassLockStats(vmThread);
+		J9HashTableState hashTableState;
+		JlmClassLockStats *stats = NULL;
+
+		if (NULL == classStats) {
+			return (jint) JLM_OUT_OF_MEMORY;
+		}
+		stats = hashTableStartDo(classStats, &hashTableState);
+		while (NULL != stats) {
+			GetClassName(vmThread, stats->clazz, monitor_name);
+			*dump_size += JLM_DUMP_CLASS_FIELD_SIZE + strlen(monitor_name) + 1;
+			stats = hashTableNextDo(&hashTableState);
+		}
+		hashTableFree(classStats);
+		return rc;
+	}
+
     /* Assumes acquireExclusiveVMAccess & release by caller */
 	/* walk all the monitors to count them */
 	omrthread_monitor_init_walk(&walkState);
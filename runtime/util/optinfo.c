@@ -129,14 +129,15 @@ getLineNumberForROMClass(J9JavaVM *vm, J9Method *method, UDATA relativePC)
 
 			for (i = 0; i < lineNumberCount; i++) {
 				if (!getNextLineNumberFromTable(&currentLineNumber, &lineNumber)) {
-					return (UDATA)-1;
+					number = (UDATA)-1;
+					break;
 				}
 				if (relativePC < lineNumber.location) {
 					break;
 				}
 				number = lineNumber.lineNumber;
 			}
-			releaseOptInfoBuffer(vm, J9_CP_FROM_METHOD(method)->ramClass->romClass);
+			releaseMethodDebugInfo(vm, J9_CLASS_FROM_METHOD(method)->romClass, methodInfo);
 		}
 	}
 
@@ -165,13 +166,32 @@ getLineNumberTable(J9MethodDebugInfo *methodInfo)
 J9MethodDebugInfo *
 getMethodDebugInfoForROMClass(J9JavaVM *vm, J9Method *method)
 {
-	/* 
-	 * This is poorly named function, with an unneeded parameter (vm)
-	 * TODO: create new signature
-	 *  J9MethodDebugInfo *
-	 *    getMethodDebugInfoForMethod(J9Method *method);
+	/*
+	 * This is poorly named function. The vm is needed to find debug info which is
+	 * stored compressed (-XX:+CompressROMClassDebugInfo).
 	 */
-	return getMethodDebugInfoFromROMMethod(getOriginalROMMethod(method));
+	return getMethodDebugInfoForROMMethod(vm, J9_CLASS_FROM_METHOD(method)->romClass, getOriginalROMMethod(method));
+}
+
+
+J9MethodDebugInfo *
+getMethodDebugInfoForROMMethod(J9JavaVM *vm, J9ROMClass *romClass, J9ROMMethod *romMethod)
+{
+	J9MethodDebugInfo *methodInfo = getMethodDebugInfoFromROMMethod(romMethod);
+
+	if ((NULL == methodInfo) && (NULL != vm) && J9ROMCLASS_HAS_COMPRESSED_DEBUG_INFO(romClass)) {
+		methodInfo = vm->internalVMFunctions->acquireCompressedMethodDebugInfo(vm, romClass, romMethod);
+	}
+	return methodInfo;
+}
+
+
+void
+releaseMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9MethodDebugInfo *methodInfo)
+{
+	if ((NULL != methodInfo) && (NULL != vm) && J9ROMCLASS_HAS_COMPRESSED_DEBUG_INFO(romClass)) {
+		vm->internalVMFunctions->releaseCompressedMethodDebugInfo(vm, romClass, methodInfo);
+	}
 }
 
 
@@ -650,7 +670,7 @@ getLineNumberForROMClassFromROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9RO
 	/* bug 113600 - bytecodeSize == 0 means that the method has been AOTd and the bytecodes have been stripped.
      So we can allow a relativePC that is >= bytecodeSize in that case */
 	if ((relativePC < bytecodeSize) || (bytecodeSize == 0)) {
-		J9MethodDebugInfo *methodInfo = getMethodDebugInfoFromROMMethod(romMethod);
+		J9MethodDebugInfo *methodInfo = getMethodDebugInfoForROMMethod(vm, romClass, romMethod);
 
 		if (methodInfo) {
 			U_8 *currentLineNumber= getLineNumberTable(methodInfo);
@@ -659,14 +679,15 @@ getLineNumberForROMClassFromROMMethod(J9JavaVM *vm, J9ROMMethod *romMethod, J9RO
 
 			for (i = 0; i < lineNumberCount; i++) {
 				if (!getNextLineNumberFromTable(&currentLineNumber, &lineNumber)) {
-					return (UDATA)-1;
+					number = (UDATA)-1;
+					break;
 				}
 				if (relativePC < lineNumber.location) {
 					break;
 				}
 				number = lineNumber.lineNumber;
 			}
-			releaseOptInfoBuffer(vm, romClass);
+			releaseMethodDebugInfo(vm, romClass, methodInfo);
 		}
 	}
 
@@ -38,10 +38,17 @@ computeHashForUTF8(const U_8 * data, UDATA length)
 	const U_8 * end = data + length;
 
 	while (data < end) {
-		U_16 c;
+		/* single byte characters hash as their byte values, so runs of them skip decoding */
+		UDATA singleByteChars = countUTF8SingleByteChars(data, (UDATA)(end - data));
 
-		data += decodeUTF8Char(data, &c);
-		hash = (hash << 5) - hash + c;
+		hash = computeHashForBytes(hash, data, singleByteChars);
+		data += singleByteChars;
+		if (data < end) {
+			U_16 c;
+
+			data += decodeUTF8Char(data, &c);
+			hash = (hash << 5) - hash + c;
+		}
 	}
 	return hash;
 }
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "util_api.h"
+
+#if defined(J9VM_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define USE_SSE2_INTRINSICS
+#include <emmintrin.h>
+#elif defined(J9VM_ARCH_AARCH64) && defined(__ARM_NEON)
+#define USE_NEON_INTRINSICS
+#include <arm_neon.h>
+#endif /* J9VM_ARCH_X86 && __SSE2__ */
+
+/**
+ * Counts the leading bytes of a UTF8 string which are complete single byte characters,
+ * i.e. which lie in the range 0x01 to 0x7F.  The count stops at the first NUL byte or
+ * the first byte of a multi-byte encoding.
+ *
+ * Sixteen bytes are checked at a time using SSE2 or NEON where available, and a word at
+ * a time otherwise.
+ *
+ * @param data points to raw UTF8 bytes
+ * @param length the number of bytes to scan
+ *
+ * @return the number of leading single byte characters
+ */
+UDATA
+countUTF8SingleByteChars(const U_8 *data, UDATA length)
+{
+	const U_8 *cursor = data;
+	const U_8 *end = data + length;
+	const UDATA lowBits = ((UDATA)-1) / 0xFF;
+	const UDATA highBits = lowBits << 7;
+
+#if defined(USE_SSE2_INTRINSICS)
+	const __m128i zero = _mm_setzero_si128();
+
+	while ((UDATA)(end - cursor) >= 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *)cursor);
+		/* 0x01 to 0x7F are exactly the bytes which are greater than zero as signed values */
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpgt_epi8(chunk, zero))) {
+			break;
+		}
+		cursor += 16;
+	}
+#elif defined(USE_NEON_INTRINSICS)
+	const uint8x16_t one = vdupq_n_u8(1);
+
+	while ((UDATA)(end - cursor) >= 16) {
+		/* subtracting one wraps NUL around to 0xFF, leaving a single range check */
+		uint8x16_t chunk = vsubq_u8(vld1q_u8(cursor), one);
+		if (vmaxvq_u8(chunk) >= 0x7F) {
+			break;
+		}
+		cursor += 16;
+	}
+#endif /* USE_SSE2_INTRINSICS */
+
+	while ((UDATA)(end - cursor) >= sizeof(UDATA)) {
+		UDATA word = 0;
+		memcpy(&word, cursor, sizeof(word));
+		/* the lowest NUL byte borrows into its own high bit, bytes above 0x7F have it set already */
+		if (0 != (((word - lowBits) | word) & highBits)) {
+			break;
+		}
+		cursor += sizeof(UDATA);
+	}
+
+	while ((cursor < end) && (((UDATA)(*cursor - 1)) < 0x7F)) {
+		cursor += 1;
+	}
+
+	return (UDATA)(cursor - data);
+}
+
+/**
+ * Continues the java/lang/String.hashCode()I hash of a string over the given bytes,
+ * treating every byte as one character.  The result is identical to running
+ * hash = (hash << 5) - hash + byte for every byte, but four bytes are folded into
+ * each step to shorten the dependency chain on the hash.
+ *
+ * @param hash the hash of the preceding characters, or the seed of the hash
+ * @param data points to the bytes to hash
+ * @param length the number of bytes to hash
+ *
+ * @return the updated hash
+ */
+UDATA
+computeHashForBytes(UDATA hash, const U_8 *data, UDATA length)
+{
+	const U_8 *end = data + length;
+
+	/* 31^4 = 923521, 31^3 = 29791, 31^2 = 961 */
+	while ((UDATA)(end - data) >= 4) {
+		hash = (hash * 923521)
+				+ ((UDATA)data[0] * 29791)
+				+ ((UDATA)data[1] * 961)
+				+ ((UDATA)data[2] * 31)
+				+ (UDATA)data[3];
+		data += 4;
+	}
+
+	while (data < end) {
+		hash = (hash << 5) - hash + *data++;
+	}
+
+	return hash;
+}
@@ -2985,6 +2985,9 @@ done:
 				/* No need for VMStructHasBeenUpdated as the above walk cannot change the roots */
 				UDATA framesWalked = walkState->framesWalked;
 				UDATA *cachePointer = walkState->cache;
+				/* Only share arrays for new walkbacks: an existing walkback may be refilled in place */
+				bool internTrace = (NULL == walkback) && (NULL != _vm->walkbackInternTable);
+				UDATA internHash = 0;
 				if (J9_STACKWALK_RC_NONE != walkRC) {
 					/* Avoid infinite recursion if already throwing OOM */
 					if (_currentThread->privateFlags & J9_PRIVATE_FLAGS_OUT_OF_MEMORY) {
@@ -3005,6 +3008,12 @@ done:
 #else
 					J9Class *arrayClass = _vm->intArrayClass;
 #endif
+					if (internTrace) {
+						walkback = findInternedWalkback(_currentThread, cachePointer, framesWalked, &internHash);
+						if (NULL != walkback) {
+							goto walkbackFilled;
+						}
+					}
 					walkback = allocateIndexableObject(REGISTER_ARGS, arrayClass, (U_32)framesWalked, false);
 					if (J9_UNEXPECTED(NULL == walkback)) {
 						rc = THROW_HEAP_OOM;
@@ -3024,6 +3033,10 @@ done:
 					_objectAccessBarrier.inlineIndexableObjectStoreI32(_currentThread, walkback, i, cachePointer[i]);
 #endif
 				}
+				if (internTrace) {
+					internWalkback(_currentThread, walkback, internHash);
+				}
+walkbackFilled:
 				freeStackWalkCaches(_currentThread, walkState);
 recursiveOOM:
 				restoreInternalNativeStackFrame(REGISTER_ARGS);
@@ -6925,8 +6938,13 @@ resolve:
 			UDATA methodIndex = methodIndexAndArgCount >> J9_ITABLE_INDEX_SHIFT;
 			J9ROMMethod *romMethod = NULL;
 
-			/* Run search in receiverClass->lastITable */
-			J9ITable *iTable = receiverClass->lastITable;
+			/* Probe the interface dispatch table of receiverClass */
+			J9ITable *iTable = J9_ITABLE_DISPATCH_PROBE(receiverClass, interfaceClass);
+			if (interfaceClass == iTable->interfaceClass) {
+				goto foundITableCache;
+			}
+			/* An interface whose dispatch slot is taken by another may still be the last one found in the list */
+			iTable = receiverClass->lastITable;
 			if (interfaceClass == iTable->interfaceClass) {
 				goto foundITableCache;
 			}
@@ -168,6 +168,13 @@ performVerification(J9VMThread *currentThread, J9Class *clazz)
 				!VM_VMHelpers::classIsBootstrap(vm, clazz))
 			) {
 				U_8 *verifyErrorStringUTF = NULL;
+				/* Verify using a context private to this thread so that classes are verified in parallel.
+				 * If no context can be allocated, the VM wide verification data is used under its mutex.
+				 */
+				J9BytecodeVerificationData *context = j9bcv_acquireVerificationContext(currentThread);
+				if (NULL != context) {
+					bcvd = context;
+				}
 				Trc_VM_verification_Start(currentThread, J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(clazz->romClass)), clazz->classLoader);
 				omrthread_monitor_enter(bcvd->verifierMutex);
 				bcvd->vmStruct = currentThread;
@@ -179,6 +186,9 @@ performVerification(J9VMThread *currentThread, J9Class *clazz)
 					/* INL had a check for Object here which is unnecessary in SE */
 					if (-2 == verifyResult) {
 						omrthread_monitor_exit(bcvd->verifierMutex);
+						if (NULL != context) {
+							j9bcv_releaseVerificationContext(currentThread, context);
+						}
 						/* vmStruct is already up to date */
 						setNativeOutOfMemoryError(currentThread, J9NLS_BCV_ERR_VERIFY_OUT_OF_MEMORY);
 						goto done;
@@ -186,6 +196,9 @@ performVerification(J9VMThread *currentThread, J9Class *clazz)
 					verifyErrorStringUTF = j9bcv_createVerifyErrorString(vm->portLibrary, bcvd);
 				}
 				omrthread_monitor_exit(bcvd->verifierMutex);
+				if (NULL != context) {
+					j9bcv_releaseVerificationContext(currentThread, context);
+				}
 				if (VM_VMHelpers::exceptionPending(currentThread)) {
 					PORT_ACCESS_FROM_JAVAVM(vm);
 					j9mem_free_memory(verifyErrorStringUTF);
@@ -63,6 +63,9 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 			UDATA walkRC = vm->walkStackFrames(currentThread, walkState);
 			UDATA framesWalked = walkState->framesWalked;
 			UDATA *cachePointer = walkState->cache;
+			/* Only share arrays for new walkbacks: an existing walkback may be refilled in place */
+			bool internTrace = (NULL == walkback) && (NULL != vm->walkbackInternTable);
+			UDATA internHash = 0;
 			if (J9_STACKWALK_RC_NONE != walkRC) {
 				/* Avoid infinite recursion if already throwing OOM */
 				if (currentThread->privateFlags & J9_PRIVATE_FLAGS_OUT_OF_MEMORY) {
@@ -80,6 +83,12 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 #else
 				J9Class *arrayClass = vm->intArrayClass;
 #endif
+				if (internTrace) {
+					walkback = findInternedWalkback(currentThread, cachePointer, framesWalked, &internHash);
+					if (NULL != walkback) {
+						goto walkbackFilled;
+					}
+				}
 				walkback = objectAllocate.inlineAllocateIndexableObject(currentThread, arrayClass, (U_32)framesWalked, false);
 				if (NULL == walkback) {
 					PUSH_OBJECT_IN_SPECIAL_FRAME(currentThread, receiver);
@@ -104,6 +113,10 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				objectAccessBarrier.inlineIndexableObjectStoreI32(currentThread, walkback, i, cachePointer[i]);
 #endif
 			}
+			if (internTrace) {
+				internWalkback(currentThread, walkback, internHash);
+			}
+walkbackFilled:
 			freeStackWalkCaches(currentThread, walkState);
 recursiveOOM:
 			J9VMJAVALANGTHROWABLE_SET_WALKBACK(currentThread, receiver, walkback);
@@ -276,7 +276,12 @@ private:
 	convertITableIndexToVirtualMethod(J9Class *receiverClass, J9Class *interfaceClass, UDATA iTableIndex) const
 	{
 		J9Method *sendMethod = NULL;
-		J9ITable *iTable = receiverClass->lastITable;
+		J9ITable *iTable = J9_ITABLE_DISPATCH_PROBE(receiverClass, interfaceClass);
+		if (interfaceClass == iTable->interfaceClass) {
+			goto foundITable;
+		}
+		/* An interface whose dispatch slot is taken by another may still be the last one found in the list */
+		iTable = receiverClass->lastITable;
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
@@ -636,6 +636,20 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 	UDATA const tryEnterSpinCount1 = vm->thrMaxTryEnterSpins1BeforeBlocking;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
+	/* Limit the yields to twice the number that recently sufficed to acquire this monitor by spinning,
+	 * so that monitors which are always held for a long time quickly stop burning CPU before blocking.
+	 * The limit never drops below J9_OBJECT_MONITOR_MIN_SPIN_YIELDS, so a monitor whose average decayed
+	 * while it was busy can earn its budget back once it is released quickly again.
+	 */
+	bool const adaptiveSpinning = (0 != vm->thrAdaptiveTryEnterSpinning);
+	IDATA spinYieldSample = -1;
+	if (adaptiveSpinning) {
+		UDATA const adaptiveYieldCount = J9_OBJECT_MONITOR_ADAPTIVE_YIELD_LIMIT(objectMonitor->spinYieldAverage);
+		if (adaptiveYieldCount < tryEnterYieldCount) {
+			tryEnterYieldCount = adaptiveYieldCount;
+		}
+	}
+
 #if defined(OMR_THR_JLM)
 	/* Initialize JLM */
 	J9ThreadMonitorTracing *tracing = NULL;
@@ -671,6 +685,7 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 		for (_tryEnterSpinCount2 = tryEnterSpinCount2; _tryEnterSpinCount2 > 0; _tryEnterSpinCount2--) {
 			rc_tryEnterUsingThreadID = omrthread_monitor_try_enter_using_threadId(monitor, osThread);
 			if (0 == rc_tryEnterUsingThreadID) {
+				spinYieldSample = (IDATA)(tryEnterYieldCount - _tryEnterYieldCount);
 #if defined(J9VM_THR_SMART_DEFLATION)
 				/* Update the monitor's pro deflation vote because we got in without blocking */
 				if (VM_AtomicSupport::sampleTimestamp(J9VM_SAMPLE_TIMESTAMP_FREQUENCY)) {
@@ -713,8 +728,20 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 		omrthread_yield();
 #endif /* OMR_THR_YIELD_ALG */
 	}
+	/* spun out - spinning on this monitor was wasted, so pull the average towards no yields */
+	spinYieldSample = 0;
 
 update_jlm:
+	if (adaptiveSpinning && (spinYieldSample >= 0)) {
+		/* Racy update is harmless - the average is only a heuristic.
+		 * The step is rounded away from zero so that the average always reaches the samples it is fed.
+		 */
+		IDATA const average = (IDATA)objectMonitor->spinYieldAverage;
+		IDATA const difference = (spinYieldSample << J9_OBJECT_MONITOR_SPIN_AVERAGE_SHIFT) - average;
+		IDATA const rounding = ((IDATA)1 << J9_OBJECT_MONITOR_SPIN_DECAY_SHIFT) - 1;
+		IDATA const delta = ((difference >= 0) ? (difference + rounding) : (difference - rounding)) / ((IDATA)1 << J9_OBJECT_MONITOR_SPIN_DECAY_SHIFT);
+		objectMonitor->spinYieldAverage = (UDATA)(average + delta);
+	}
 #if defined(OMR_THR_JLM)
 	if (NULL != tracing) {
 		/* Add JLM counts atomically:
@@ -747,6 +774,11 @@ update_jlm:
 		}
 		VM_AtomicSupport::add(&tracing->yield_count, yieldCount);
 		VM_AtomicSupport::add(&tracing->spin2_count, spin2Count);
+		if (rc) {
+			VM_AtomicSupport::add(&objectMonitor->spinAcquireCount, 1);
+		} else if (0 == _tryEnterYieldCount) {
+			VM_AtomicSupport::add(&objectMonitor->spinBlockCount, 1);
+		}
 	}
 #endif /* OMR_THR_JLM */
 
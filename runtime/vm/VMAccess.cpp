@@ -324,6 +324,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->vmThreadListMutex);
 
 		vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+		vm->globalSafePointCount += 1;
 	}
 	Assert_VM_true(J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState);
 	Trc_VM_acquireExclusiveVMAccess_Exit(vmThread);
@@ -807,7 +808,7 @@ acquireExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 	/* Wait for all threads to respond to the halt request */
 
 	waitForResponseFromExternalThread(vm, vmResponsesExpected, jniResponsesExpected);
-
+	vm->globalSafePointCount += 1;
 }
 
 void
@@ -992,6 +993,7 @@ waitForExclusiveVMAccessMetronomeTemp(J9VMThread * vmThread, UDATA vmResponsesRe
 	Assert_VM_true(vmThread->omrVMThread->exclusiveCount==0);
 	
 	++(vmThread->omrVMThread->exclusiveCount);
+	vmThread->javaVM->globalSafePointCount += 1;
 }
 
 void
@@ -1184,6 +1186,7 @@ retry:
 			goto retry;
 		}
 		vm->safePointState = J9_XACCESS_EXCLUSIVE;
+		vm->globalSafePointCount += 1;
 		omrthread_monitor_exit(vm->exclusiveAccessMutex);
 		// Not necessary?
 		VM_VMAccess::clearPublicFlags(vmThread, J9_PUBLIC_FLAGS_HALTED_AT_SAFE_POINT | J9_PUBLIC_FLAGS_NOT_COUNTED_BY_SAFE_POINT);
@@ -1314,4 +1317,23 @@ resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread)
 	}
 }
 
+void
+handshakeThread(J9VMThread * currentThread, J9VMThread * targetThread, J9ThreadHandshakeFunction function, void * userData)
+{
+	Assert_VM_mustHaveVMAccess(currentThread);
+	Trc_VM_handshakeThread_Entry(currentThread, targetThread);
+
+	/* Only targetThread is stopped: it halts at its next VM access release or async check,
+	 * or immediately if it is running without VM access.
+	 */
+	if (currentThread != targetThread) {
+		VM_AtomicSupport::add(&currentThread->javaVM->targetedHandshakeCount, 1);
+	}
+	haltThreadForInspection(currentThread, targetThread);
+	function(currentThread, targetThread, userData);
+	resumeThreadForInspection(currentThread, targetThread);
+
+	Trc_VM_handshakeThread_Exit(currentThread);
+}
+
 } /* extern "C" */
@@ -235,7 +235,12 @@ mapVirtualMethod(J9VMThread *currentThread, J9Method *method, UDATA vTableOffset
 		UDATA iTableIndex = vTableOffset & ~(UDATA)J9_JNI_MID_INTERFACE;
 		J9Class *interfaceClass = J9_CLASS_FROM_METHOD(method);
 		vTableOffset = 0;
-		J9ITable * iTable = receiverClass->lastITable;
+		J9ITable * iTable = J9_ITABLE_DISPATCH_PROBE(receiverClass, interfaceClass);
+		if (interfaceClass == iTable->interfaceClass) {
+			goto foundITable;
+		}
+		/* An interface whose dispatch slot is taken by another may still be the last one found in the list */
+		iTable = receiverClass->lastITable;
 		if (interfaceClass == iTable->interfaceClass) {
 			goto foundITable;
 		}
@@ -414,6 +414,19 @@ freeClassLoader(J9ClassLoader *classLoader, J9JavaVM *javaVM, J9VMThread *vmThre
 		classLoader->classRelationshipsHashTable = NULL;
 	}
 
+	/* Free the cached stack and local maps, which are keyed by addresses within the ROM classes of this loader */
+	if (NULL != classLoader->localMapCache) {
+		hashTableFree(classLoader->localMapCache);
+		classLoader->localMapCache = NULL;
+	}
+	if (NULL != classLoader->stackMapCache) {
+		hashTableFree(classLoader->stackMapCache);
+		classLoader->stackMapCache = NULL;
+	}
+
+	/* Free the compressed debug info of the ROM classes of this loader */
+	freeClassLoaderCompressedDebugInfo(javaVM, classLoader);
+
 	TRIGGER_J9HOOK_VM_CLASS_LOADER_DESTROY(javaVM->hookInterface, javaVM, classLoader);
 	ACQUIRE_CLASS_LOADER_BLOCKS_MUTEX(javaVM);
 
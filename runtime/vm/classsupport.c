@@ -607,11 +607,11 @@ attemptDynamicClassLoad(J9VMThread* vmThread, J9Module *j9module, U_8* className
 				if (NULL == dynamicLoadBuffers) {
 					setCurrentExceptionUTF(vmThread, J9VMCONSTANTPOOL_JAVALANGNOCLASSDEFFOUNDERROR, "dynamic loader is unavailable");
 				} else {
-					UDATA defineClassOptions = options & ~J9_FINDCLASS_FLAG_USE_LOADER_CP_ENTRIES;	/* allow define class to use normal findClass */
+					UDATA defineClassOptions = (options & ~J9_FINDCLASS_FLAG_USE_LOADER_CP_ENTRIES) | J9_FINDCLASS_FLAG_LOCALLY_DEFINED;	/* allow define class to use normal findClass */
 
 					/* this function exits the class table mutex */
 					foundClass = dynamicLoadBuffers->internalDefineClassFunction(vmThread, className, classNameLength,
-						dynamicLoadBuffers->sunClassFileBuffer, dynamicLoadBuffers->currentSunClassFileSize,
+						dynamicLoadBuffers->currentSunClassFileData, dynamicLoadBuffers->currentSunClassFileSize,
 						NULL, classLoader, NULL, defineClassOptions, NULL, NULL, &localBuffer); /* this function exits the class table mutex */
 				}
 			} else {
@@ -621,7 +621,7 @@ attemptDynamicClassLoad(J9VMThread* vmThread, J9Module *j9module, U_8* className
 				 */
 				J9ROMClass *romClass = (J9ROMClass *) findResult;
 				if ((NULL != vmThread->javaVM->sharedClassConfig) && (0 != vmThread->javaVM->sharedClassConfig->isBCIEnabled(vmThread->javaVM))) {
-					UDATA defineClassOptions = options & ~J9_FINDCLASS_FLAG_USE_LOADER_CP_ENTRIES;	/* allow define class to use normal findClass */
+					UDATA defineClassOptions = (options & ~J9_FINDCLASS_FLAG_USE_LOADER_CP_ENTRIES) | J9_FINDCLASS_FLAG_LOCALLY_DEFINED;	/* allow define class to use normal findClass */
 
 					defineClassOptions |= J9_FINDCLASS_FLAG_SHRC_ROMCLASS_EXISTS;
 
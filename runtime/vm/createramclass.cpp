@@ -52,6 +52,12 @@ extern "C" {
 
 #define LOCAL_INTERFACE_ARRAY_SIZE 10
 
+/* Superclass vTables at least this large are searched through a name/signature hash index when
+ * the new class declares enough methods to pay for building it.  Smaller vTables are scanned.
+ */
+#define VTABLE_HASH_INDEX_MIN_SIZE 64
+#define VTABLE_HASH_INDEX_MIN_METHODS 4
+
 #define DEFAULLT_NUMBER_OF_ENTRIES_IN_FLATTENED_CLASS_CACHE 8
 
 enum J9ClassFragments {
@@ -97,6 +103,8 @@ enum J9ClassFragments {
 
 /* Static J9ITable used as a non-NULL iTable cache value by classes that don't implement any interfaces. Defined in hshelp.c. */
 extern const J9ITable invalidITable;
+/* Static interface dispatch table shared by classes which have no dispatch table of their own. Defined in hshelp.c. */
+extern J9ITable * const invalidITableDispatch[J9_ITABLE_DISPATCH_SIZE];
 
 typedef struct J9RAMClassFreeListLargeBlock {
     UDATA size;
@@ -135,6 +143,12 @@ typedef struct J9OverrideErrorData {
 	J9UTF8 *methodSigUTF;
 } J9OverrideErrorData;
 
+typedef struct J9VTableNameSigIndex {
+	UDATA *buckets; /* 1-based index of the highest vTable slot hashing to each bucket, 0 if empty */
+	UDATA *chain; /* 1-based index of the next lower vTable slot in the same bucket, 0 at the end */
+	UDATA bucketMask;
+} J9VTableNameSigIndex;
+
 static J9Class* markInterfaces(J9ROMClass *romClass, J9Class *superclass, J9ClassLoader *classLoader, BOOLEAN *foundCloneable, UDATA *markedInterfaceCount, UDATA *inheritedInterfaceCount, IDATA *maxInterfaceDepth);
 static void unmarkInterfaces(J9Class *interfaceHead);
 static void createITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *interfaceClass, J9ITable ***previousLink, UDATA **currentSlot, UDATA depth);
@@ -142,9 +156,12 @@ static UDATA* initializeRAMClassITable(J9VMThread* vmStruct, J9Class *ramClass,
 static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData);
 static UDATA* computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *superclass, J9ROMClass *taggedClass, UDATA packageID, J9ROMMethod ** methodRemapArray, J9Class *interfaceHead, UDATA *defaultConflictCount, UDATA interfaceCount, UDATA inheritedInterfaceCount, J9OverrideErrorData *errorData);
 static void copyVTable(J9VMThread *vmStruct, J9Class *ramClass, J9Class *superclass, UDATA *vTable, UDATA defaultConflictCount);
-static UDATA processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData);
+static UDATA processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData, J9VTableNameSigIndex *superclassIndex);
 static VMINLINE UDATA growNewVTableSlot(UDATA *vTableAddress, UDATA vTableMethodCount, void *storeValue);
 static UDATA getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex);
+static VMINLINE UDATA hashVTableNameAndSig(J9UTF8 *name, J9UTF8 *signature);
+static bool buildVTableNameSigIndex(J9VMThread *vmStruct, J9VTableNameSigIndex *index, UDATA *vTable, UDATA vTableSize);
+static UDATA getVTableIndexFromNameSigIndex(J9VTableNameSigIndex *index, UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex);
 static UDATA checkPackageAccess(J9VMThread *vmThread, J9Class *foundClass, UDATA classPreloadFlags);
 static void setCurrentExceptionForBadClass(J9VMThread *vmThread, J9UTF8 *badClassName, UDATA exceptionIndex, U_32 nlsModuleName, U_32 nlsMessageID);
 static BOOLEAN verifyClassLoadingStack(J9VMThread *vmThread, J9ClassLoader *classLoader, J9ROMClass *romClass);
@@ -737,6 +754,8 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 	UDATA maxSlots;
 	UDATA *vTableAddress = NULL;
 	bool vTableAllocated = false;
+	J9VTableNameSigIndex superclassIndex = { NULL, NULL, 0 };
+	J9VTableNameSigIndex *superclassIndexPtr = NULL;
 
 	PORT_ACCESS_FROM_VMC(vmStruct);
 
@@ -827,6 +846,20 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 			UDATA romMethodIndex = 0;
 			UDATA count = romClass->romMethodCount;
 
+			/* Deep hierarchies have large vTables: index the superclass vTable by name and signature so
+			 * that finding the overridden slots does not cost a scan of the whole vTable per method.
+			 * If the index cannot be allocated, fall back to scanning.
+			 */
+			if ((NULL != superclass)
+				&& (vTableMethodCount >= VTABLE_HASH_INDEX_MIN_SIZE)
+				&& (count >= VTABLE_HASH_INDEX_MIN_METHODS)
+			) {
+				J9VTableHeader *superVTable = J9VTABLE_HEADER_FROM_RAM_CLASS(superclass);
+				if (buildVTableNameSigIndex(vmStruct, &superclassIndex, (UDATA *)J9VTABLE_FROM_HEADER(superVTable), vTableMethodCount)) {
+					superclassIndexPtr = &superclassIndex;
+				}
+			}
+
 			/* Walk over ROM Methods. If the methodRemapArray is supplied, use the array as a source of
 			 * J9ROMMethods instead of romClass->romMethods.  The methodRemapArray is specified by
 			 * HCR to ensure that the replacement class vtable has the same method order as the original class
@@ -847,7 +880,7 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 					&& ('<' != J9UTF8_DATA(methodName)[0])
 					) {
 						vTableMethodCount = processVTableMethod(vmStruct, classLoader, vTableAddress, superclass, romClass, romMethod,
-								packageID, vTableMethodCount, (J9ROMMethod *)((UDATA)romMethod + ROM_METHOD_ID_TAG), errorData);
+								packageID, vTableMethodCount, (J9ROMMethod *)((UDATA)romMethod + ROM_METHOD_ID_TAG), errorData, superclassIndexPtr);
 						if ((UDATA)-1 == vTableMethodCount) {
 							goto fail;
 						}
@@ -949,6 +982,8 @@ computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *supercl
 	}
 
 done:
+	/* The index is only needed while processing the methods declared by this class */
+	j9mem_free_memory(superclassIndex.buckets);
 	return vTableAddress;
 fail:
 	if (vTableAllocated) {
@@ -1182,7 +1217,7 @@ fillJITVTableSlot(J9VMThread *vmStruct, UDATA *currentSlot, J9Method *currentMet
 #endif
 
 static UDATA
-processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData)
+processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, J9ROMMethod *romMethod, UDATA localPackageID, UDATA vTableMethodCount, void *storeValue, J9OverrideErrorData *errorData, J9VTableNameSigIndex *superclassIndex)
 {
 	UDATA newModifiers = romMethod->modifiers;
 	bool verifierEnabled = J9_ARE_ANY_BITS_SET(vmThread->javaVM->runtimeFlags, J9_RUNTIME_VERIFY);
@@ -1204,8 +1239,9 @@ processVTableMethod(J9VMThread *vmThread, J9ClassLoader *classLoader, UDATA *vTa
 			}
 
 			/* See if this method overrides any methods from any superclass. */
-			while ((superclassVTableIndex = getVTableIndexForNameAndSigStartingAt(superclassVTableMethods, nameUTF, sigUTF,
-					superclassVTableIndex)) != (UDATA)-1)
+			while ((superclassVTableIndex = ((NULL == superclassIndex)
+					? getVTableIndexForNameAndSigStartingAt(superclassVTableMethods, nameUTF, sigUTF, superclassVTableIndex)
+					: getVTableIndexFromNameSigIndex(superclassIndex, superclassVTableMethods, nameUTF, sigUTF, superclassVTableIndex))) != (UDATA)-1)
 			{
 				UDATA overridden = FALSE;
 				/* fetch vTable entry */
@@ -1373,6 +1409,81 @@ getVTableIndexForNameAndSigStartingAt(UDATA *vTable, J9UTF8 *name, J9UTF8 *signa
 	return (UDATA)-1;
 }
 
+static VMINLINE UDATA
+hashVTableNameAndSig(J9UTF8 *name, J9UTF8 *signature)
+{
+	return (computeHashForUTF8(J9UTF8_DATA(name), J9UTF8_LENGTH(name)) * 31)
+		+ computeHashForUTF8(J9UTF8_DATA(signature), J9UTF8_LENGTH(signature));
+}
+
+/**
+ * Build a name/signature hash index over a vTable.  Each bucket chains its slots from the
+ * highest index down, which is the order the linear search visits them in.
+ *
+ * @param vmStruct[in] the current J9VMThread
+ * @param index[out] the index to initialize; index->buckets must be freed by the caller
+ * @param vTable[in] the vTable methods (not the header)
+ * @param vTableSize[in] the number of methods in the vTable
+ * @return true if the index was built, false if it could not be allocated
+ */
+static bool
+buildVTableNameSigIndex(J9VMThread *vmStruct, J9VTableNameSigIndex *index, UDATA *vTable, UDATA vTableSize)
+{
+	PORT_ACCESS_FROM_VMC(vmStruct);
+	UDATA bucketCount = 1;
+	UDATA vTableIndex = 0;
+
+	/* Keep the load factor at or below one half */
+	while (bucketCount < (vTableSize * 2)) {
+		bucketCount <<= 1;
+	}
+	index->buckets = (UDATA *)j9mem_allocate_memory((bucketCount + vTableSize) * sizeof(UDATA), J9MEM_CATEGORY_CLASSES);
+	if (NULL == index->buckets) {
+		return false;
+	}
+	memset(index->buckets, 0, bucketCount * sizeof(UDATA));
+	index->chain = index->buckets + bucketCount;
+	index->bucketMask = bucketCount - 1;
+
+	for (vTableIndex = 0; vTableIndex < vTableSize; vTableIndex++) {
+		J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD((J9Method *)vTable[vTableIndex]);
+		UDATA bucket = hashVTableNameAndSig(J9ROMMETHOD_NAME(romMethod), J9ROMMETHOD_SIGNATURE(romMethod)) & index->bucketMask;
+
+		index->chain[vTableIndex] = index->buckets[bucket];
+		index->buckets[bucket] = vTableIndex + 1;
+	}
+	return true;
+}
+
+/**
+ * Equivalent of getVTableIndexForNameAndSigStartingAt using an index built by buildVTableNameSigIndex.
+ *
+ * @param index[in] the name/signature index of vTable
+ * @param vTable[in] the vTable methods (not the header)
+ * @param name[in] the method name
+ * @param signature[in] the method signature
+ * @param vTableIndex[in] 1-based index to search down from
+ * @return the 0-based index of the highest matching slot below vTableIndex, or -1 if none
+ */
+static UDATA
+getVTableIndexFromNameSigIndex(J9VTableNameSigIndex *index, UDATA *vTable, J9UTF8 *name, J9UTF8 *signature, UDATA vTableIndex)
+{
+	UDATA slot = index->buckets[hashVTableNameAndSig(name, signature) & index->bucketMask];
+
+	while (0 != slot) {
+		if (slot <= vTableIndex) {
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD((J9Method *)vTable[slot - 1]);
+			if (J9UTF8_EQUALS(name, J9ROMMETHOD_NAME(romMethod))
+				&& J9UTF8_EQUALS(signature, J9ROMMETHOD_SIGNATURE(romMethod))
+			) {
+				return slot - 1;
+			}
+		}
+		slot = index->chain[slot - 1];
+	}
+	return (UDATA)-1;
+}
+
 UDATA
 getVTableOffsetForMethod(J9Method * method, J9Class *clazz, J9VMThread *vmThread)
 {
@@ -2120,6 +2231,7 @@ internalCreateRAMClassFromROMClassImpl(J9VMThread *vmThread, J9ClassLoader *clas
 	UDATA *instanceDescription = NULL;
 	UDATA instanceDescriptionSlotCount = 0;
 	UDATA iTableSlotCount = 0;
+	UDATA iTableDispatchSlotCount = 0;
 	IDATA maxInterfaceDepth = -1;
 	UDATA inheritedInterfaceCount = 0;
 	UDATA defaultConflictCount = 0;
@@ -2177,11 +2289,10 @@ fail:
 		}
 	}
 
-	/* Now that all required classes are loaded, reacquire the classTableMutex and see if the new class has appeared in the table.
-	 * If so, return that one.  If not, create the new class and put it in the class table.
+	/* computeRAMSizeForROMClass: the parts which depend only on the ROM class and the (already linked) superclass,
+	 * including the instance field layout and the static slot count, are computed before the classTableMutex is
+	 * taken so that concurrent loads do not serialize on them.
 	 */
-	omrthread_monitor_enter(javaVM->classTableMutex);
-	/* computeRAMSizeForROMClass */
 	{
 		classSize = sizeof(J9Class) / sizeof(void *);
 
@@ -2249,6 +2360,35 @@ fail:
 			classSize += J9CLASS_DEPTH(superclass);
 			classSize++;
 		}
+	}
+
+	/* Now that all required classes are loaded, reacquire the classTableMutex and see if the new class has appeared in the table.
+	 * If so, return that one.  If not, create the new class and put it in the class table.
+	 */
+	omrthread_monitor_enter(javaVM->classTableMutex);
+	if (!hotswapping) {
+		/* Check before linking, so that a thread which lost the race to define the class does not mark the
+		 * interfaces and build the vTable only to throw them away.
+		 */
+		if (elementClass == NULL) {
+			ramClass = hashClassTableAt(classLoader, J9UTF8_DATA(className), J9UTF8_LENGTH(className));
+		} else {
+			ramClass = elementClass->arrayClass;
+		}
+		state->ramClass = ramClass;
+
+		if (ramClass != NULL) {
+			popFromClassLoadingStack(vmThread);
+			omrthread_monitor_exit(javaVM->classTableMutex);
+			Trc_VM_CreateRAMClassFromROMClass_alreadyLoaded(vmThread, state->ramClass);
+			return internalCreateRAMClassDropAndReturn(vmThread, romClass, state);
+		}
+	}
+	/* computeRAMSizeForROMClass: interface and vTable slots. markInterfaces links the superinterfaces
+	 * through their instanceDescription fields and computeVTable records class loading constraints,
+	 * so these must stay inside the classTableMutex.
+	 */
+	{
 		if (fastHCR) {
 			interfaceHead = NULL;
 			/* Obsolete classes do not need a vTable since no new method invocations should be done through them. */
@@ -2317,8 +2457,25 @@ fail:
 					} while (NULL != allInterfaces);
 					interfaceWalk = (J9Class *)((UDATA)interfaceWalk->instanceDescription & ~INTERFACE_TAG);
 				}
+
+				/* Only concrete classes with at least two iTables get a dispatch table, placed after their
+				 * iTables.  The others share invalidITableDispatch and find their one iTable through lastITable.
+				 */
+				if (J9_ARE_NO_BITS_SET(romClass->modifiers, J9AccAbstract) && !J9ROMCLASS_IS_ARRAY(romClass)) {
+					UDATA iTableCount = interfaceCount;
+					if (NULL != superclass) {
+						J9ITable *superclassITable = (J9ITable *)superclass->iTable;
+						while (NULL != superclassITable) {
+							iTableCount += 1;
+							superclassITable = superclassITable->next;
+						}
+					}
+					if (iTableCount >= 2) {
+						iTableDispatchSlotCount = J9_ITABLE_DISPATCH_SIZE;
+					}
+				}
 			}
-			classSize += iTableSlotCount;
+			classSize += iTableSlotCount + iTableDispatchSlotCount;
 		}
 
 		/* Convert count to bytes and round to required alignment */
@@ -2362,22 +2519,6 @@ fail:
 		return internalCreateRAMClassDone(vmThread, classLoader, romClass, options, elementClass, className, state);
 	}
 
-	if (!hotswapping) {
-		if (elementClass == NULL) {
-			ramClass = hashClassTableAt(classLoader, J9UTF8_DATA(className), J9UTF8_LENGTH(className));
-		} else {
-			ramClass = elementClass->arrayClass;
-		}
-		state->ramClass = ramClass;
-
-		if (ramClass != NULL) {
-			unmarkInterfaces(interfaceHead);
-			popFromClassLoadingStack(vmThread);
-			omrthread_monitor_exit(javaVM->classTableMutex);
-			Trc_VM_CreateRAMClassFromROMClass_alreadyLoaded(vmThread, state->ramClass);
-			return internalCreateRAMClassDropAndReturn(vmThread, romClass, state);
-		}
-	}
 	if (classSize != 0) {
 		if (ramClass == NULL) {
 			J9MemorySegment *segment;
@@ -2417,7 +2558,7 @@ fail:
 			/* iTable fragment */
 			allocationRequests[RAM_ITABLE_FRAGMENT].prefixSize = 0;
 			allocationRequests[RAM_ITABLE_FRAGMENT].alignment = sizeof(UDATA);
-			allocationRequests[RAM_ITABLE_FRAGMENT].alignedSize = iTableSlotCount * sizeof(UDATA);
+			allocationRequests[RAM_ITABLE_FRAGMENT].alignedSize = (iTableSlotCount + iTableDispatchSlotCount) * sizeof(UDATA);
 			allocationRequests[RAM_ITABLE_FRAGMENT].address = NULL;
 
 			/* static slots fragment */
@@ -2500,6 +2641,7 @@ fail:
 				if (fastHCR) {
 					/* Share iTable and instanceDescription (and associated fields) with class being redefined. */
 					ramClass->iTable = classBeingRedefined->iTable;
+					ramClass->iTableDispatch = classBeingRedefined->iTableDispatch;
 					ramClass->instanceDescription = classBeingRedefined->instanceDescription;
 #if defined(J9VM_GC_LEAF_BITS)
 					ramClass->instanceLeafDescription = classBeingRedefined->instanceLeafDescription;
@@ -2511,6 +2653,11 @@ fail:
 				} else {
 					instanceDescription = allocationRequests[RAM_INSTANCE_DESCRIPTION_FRAGMENT].address;
 					iTable = allocationRequests[RAM_ITABLE_FRAGMENT].address;
+					if (0 != iTableDispatchSlotCount) {
+						ramClass->iTableDispatch = (J9ITable **) (iTable + iTableSlotCount);
+					} else {
+						ramClass->iTableDispatch = (J9ITable **) invalidITableDispatch;
+					}
 				}
 				ramClass->superclasses = (J9Class **) allocationRequests[RAM_SUPERCLASSES_FRAGMENT].address;
 				ramClass->ramStatics = allocationRequests[RAM_STATICS_FRAGMENT].address;
@@ -2803,6 +2950,7 @@ fail:
 			if (NULL == ramClass->lastITable) {
 				ramClass->lastITable = (J9ITable *) &invalidITable;
 			}
+			initializeITableDispatch(ramClass);
 
 			if (foundCloneable) {
 				ramClass->classDepthAndFlags |= J9AccClassCloneable;
@@ -41,6 +41,7 @@
 #define NATIVE_MEMORY_OOM_MSG "native memory exhausted"
 
 static void internalSetCurrentExceptionWithCause(J9VMThread *currentThread, UDATA exceptionNumber, UDATA *detailMessage, const char *utfMessage, j9object_t cause);
+static UDATA hashWalkbackPCs(UDATA *pcs, UDATA count);
 
 
 /* Helper macro for ALWAYS_TRIGGER_J9HOOK_VM_METHOD_RETURN */
@@ -1287,3 +1288,92 @@ setIllegalAccessErrorFinalFieldSet(J9VMThread *currentThread, UDATA isStatic, J9
 	setCurrentExceptionUTF(currentThread, J9VMCONSTANTPOOL_JAVALANGILLEGALACCESSERROR, msg);
 	j9mem_free_memory(msg);
 }
+
+
+static UDATA
+hashWalkbackPCs(UDATA *pcs, UDATA count)
+{
+	UDATA hash = count;
+	UDATA i = 0;
+
+	for (i = 0; i < count; i++) {
+		hash = (hash * 31) + (pcs[i] ^ (pcs[i] >> 16));
+	}
+	return hash;
+}
+
+
+j9object_t
+findInternedWalkback(J9VMThread *currentThread, UDATA *pcs, UDATA count, UDATA *hash)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA walkbackHash = hashWalkbackPCs(pcs, count);
+	J9WalkbackInternEntry *entry = &vm->walkbackInternTable[walkbackHash & (J9_WALKBACK_INTERN_TABLE_SIZE - 1)];
+	jobject ref = entry->walkback;
+	j9object_t walkback = NULL;
+
+	*hash = walkbackHash;
+	/* Entries are updated without locking, so the hash only filters: the PCs are always compared */
+	if ((NULL != ref) && (walkbackHash == entry->hash)) {
+		j9object_t candidate = vm->memoryManagerFunctions->j9gc_objaccess_readObjectFromInternalVMSlot(currentThread, (j9object_t *)ref);
+
+		if ((NULL != candidate) && (count == J9INDEXABLEOBJECT_SIZE(currentThread, candidate))) {
+			UDATA i = 0;
+
+			for (i = 0; i < count; i++) {
+				if (pcs[i] != J9JAVAARRAYOFUDATA_LOAD(currentThread, candidate, i)) {
+					break;
+				}
+			}
+			if (i == count) {
+				walkback = candidate;
+				Trc_VM_findInternedWalkback_Hit(currentThread, walkback, count);
+			}
+		}
+	}
+	return walkback;
+}
+
+
+void
+internWalkback(J9VMThread *currentThread, j9object_t walkback, UDATA hash)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9WalkbackInternEntry *entry = &vm->walkbackInternTable[hash & (J9_WALKBACK_INTERN_TABLE_SIZE - 1)];
+	jobject ref = entry->walkback;
+	UDATA depth = J9INDEXABLEOBJECT_SIZE(currentThread, walkback);
+
+	/* A stack walk cannot be cut short without losing frames, so the call site depth cache instead keeps
+	 * walkbacks from call sites reached at varying depths, which would rarely be shared, from evicting
+	 * entries which are. The entry is updated without locking: a torn entry only decides whether to intern.
+	 */
+	if (0 != depth) {
+		UDATA callSite = J9JAVAARRAYOFUDATA_LOAD(currentThread, walkback, 0);
+		J9WalkbackDepthEntry *depthEntry = &vm->walkbackDepthCache[(callSite ^ (callSite >> 9)) & (J9_WALKBACK_DEPTH_CACHE_SIZE - 1)];
+
+		if ((callSite != depthEntry->callSite) || (depth != depthEntry->depth)) {
+			depthEntry->callSite = callSite;
+			depthEntry->depth = depth;
+			return;
+		}
+	}
+
+	/* The weak ref of an entry is created once and never deleted, so that readers never see a freed ref.
+	 * Later walkbacks for the same bucket replace the referent.
+	 */
+	if (NULL == ref) {
+		ref = j9jni_createGlobalRef((JNIEnv *)currentThread, walkback, JNI_TRUE);
+		if (NULL == ref) {
+			return;
+		}
+		if (0 == compareAndSwapUDATA((UDATA *)&entry->walkback, 0, (UDATA)ref)) {
+			entry->hash = hash;
+			return;
+		}
+		/* Another thread created the ref for this entry first */
+		j9jni_deleteGlobalRef((JNIEnv *)currentThread, ref, JNI_TRUE);
+		ref = entry->walkback;
+	}
+	entry->hash = hash;
+	vm->memoryManagerFunctions->j9gc_objaccess_storeObjectToInternalVMSlot(currentThread, (j9object_t *)ref, walkback);
+}
@@ -382,4 +382,10 @@ J9InternalVMFunctions J9InternalFunctions = {
 	getFlattenableFieldType,
 	getFlattenableFieldSize,
 	arrayElementSize,
+	handshakeThread,
+	storeCompressedROMClassDebugInfo,
+	acquireCompressedMethodDebugInfo,
+	releaseCompressedMethodDebugInfo,
+	findInternedWalkback,
+	internWalkback,
 };
@@ -1490,6 +1490,8 @@ void  initializeJNITable(J9JavaVM *vm)
  * 1) Private routine.  Used to delete a jni global reference from an actual object pointer.
  * 2) We don't acquire VM access - caller must already have it.
  * 3) globalRef may be NULL
+ * 4) The slot goes straight back to the shared pool, so that a ref deleted twice, or a pointer
+ *    which is not a global ref at all, is ignored rather than handed out again.
  */
 void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
@@ -1527,30 +1529,48 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
  * 2) We don't acquire VM access - if you have an object pointer in your hands, you had better already have it.
  * 3) Does not accept NULL for object (NULL check must be done by caller)
  * 4) Returns NULL if ref creation failed.
+ * 5) Slots are taken from the current thread's cache of reserved slots, which is refilled
+ *    from the shared pool under the jniFrameMutex a cache full at a time.
  */
 jobject JNICALL
 j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 {
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
-	j9object_t * result;
+	j9object_t ** cache = isWeak ? vmThread->jniWeakGlobalRefCache : vmThread->jniGlobalRefCache;
+	UDATA * cacheCount = isWeak ? &vmThread->jniWeakGlobalRefCacheCount : &vmThread->jniGlobalRefCacheCount;
+	j9object_t * result = NULL;
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	if (0 == *cacheCount) {
+		J9Pool * pool = isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+		omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 
-	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
-	if (result != NULL) {
-		/* Initialize the ref under mutex as a concurrent collector may read from the slot as soon as we release the mutex */
-		*result = object;
-	}
+		while (*cacheCount < J9VM_JNI_GLOBAL_REF_CACHE_SIZE) {
+			j9object_t * slot = (j9object_t*)pool_newElement(pool);
+
+			if (NULL == slot) {
+				break;
+			}
+			/* Initialize the slot under mutex as a concurrent collector may read from it as soon as we release the mutex */
+			*slot = NULL;
+			cache[(*cacheCount)++] = slot;
+		}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
+	}
+
+	if (0 != *cacheCount) {
+		result = cache[--*cacheCount];
+		*result = object;
+	}
 
 	if (result == NULL) {
 		fatalError(env, "Could not allocate JNI global ref");
@@ -1561,6 +1581,35 @@ j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 }
 
 
+void
+flushJNIGlobalRefCaches(J9VMThread *vmThread)
+{
+	J9JavaVM * vm = vmThread->javaVM;
+	UDATA i;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+
+	for (i = 0; i < vmThread->jniGlobalRefCacheCount; ++i) {
+		if (pool_includesElement(vm->jniGlobalReferences, vmThread->jniGlobalRefCache[i]) == TRUE) {
+			pool_removeElement(vm->jniGlobalReferences, vmThread->jniGlobalRefCache[i]);
+		}
+	}
+	for (i = 0; i < vmThread->jniWeakGlobalRefCacheCount; ++i) {
+		if (pool_includesElement(vm->jniWeakGlobalReferences, vmThread->jniWeakGlobalRefCache[i]) == TRUE) {
+			pool_removeElement(vm->jniWeakGlobalReferences, vmThread->jniWeakGlobalRefCache[i]);
+		}
+	}
+	vmThread->jniGlobalRefCacheCount = 0;
+	vmThread->jniWeakGlobalRefCacheCount = 0;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+}
+
+
 /*
  * 1) Private routine.  Used to delete a jni local reference.
  * 2) We don't acquire VM access - caller must already have it.
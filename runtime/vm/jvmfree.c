@@ -214,6 +214,18 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 		vm->memoryManagerFunctions->cleanupMutatorModelJava(vmThread);
 	}
 
+	/* Return any global ref slots cached by this thread to the shared pools.  As above, holding
+	 * the vmThreadListMutex keeps the collector from walking the pools while they change.
+	 */
+	if ((NULL != vm->jniGlobalReferences) && (NULL != vm->jniWeakGlobalReferences)) {
+		flushJNIGlobalRefCaches(vmThread);
+	}
+
+	/* Keep the monitor table lookup counts of exited threads */
+	vm->monitorTableCacheHits += vmThread->monitorTableCacheHits;
+	vm->monitorTableIndexHits += vmThread->monitorTableIndexHits;
+	vm->monitorTableMisses += vmThread->monitorTableMisses;
+
 	/* Call destroy hook if requested */
 	if (sendThreadDestroyEvent) {
 		TRIGGER_J9HOOK_VM_THREAD_DESTROY(vm->hookInterface, vmThread);
@@ -777,6 +777,14 @@ freeJavaVM(J9JavaVM * vm)
 		vm->jniWeakGlobalReferences = NULL;
 	}
 
+	/* The interned walkback refs were allocated from the weak global ref pool freed above */
+	j9mem_free_memory(vm->walkbackInternTable);
+	vm->walkbackInternTable = NULL;
+	vm->walkbackDepthCache = NULL;
+
+	/* The class loaders freed above have already released their compressed debug info */
+	freeCompressedDebugInfo(vm);
+
 	if (NULL != vm->classLoaderBlocks) {
 		pool_kill(vm->classLoaderBlocks);
 		vm->classLoaderBlocks = NULL;
@@ -1872,6 +1880,22 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				}
 			}
 
+			/* Honour the reference implementation's switch for not mapping jar files,
+			 * unless -XX:[+-]MapClassFileData was given explicitly.
+			 */
+			argIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, VMOPT_XXNOMAPCLASSFILEDATA, NULL);
+			argIndex2 = FIND_ARG_IN_VMARGS(EXACT_MATCH, VMOPT_XXMAPCLASSFILEDATA, NULL);
+			if ((argIndex < 0) && (argIndex2 < 0)) {
+				J9VMSystemProperty* prop = NULL;
+
+				if ((J9SYSPROP_ERROR_NONE == getSystemProperty(vm, "sun.zip.disableMemoryMapping", &prop))
+				&& (NULL != prop->value)
+				&& (0 != strcmp(prop->value, "false"))
+				) {
+					vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING;
+				}
+			}
+
 #if !defined(WIN32) && !defined(J9ZTPF)
 			/* Override the soft limit on the number of open file descriptors for
 			 * compatibility with reference implementation.
@@ -2140,6 +2164,23 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			if (NULL == (vm->jniWeakGlobalReferences = pool_new(sizeof(UDATA), 0, 0, POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(vm->portLibrary))))
 				goto _error;
 
+			if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_INTERN_STACK_TRACES)) {
+				/* The call site depth cache follows the intern table in the same allocation */
+				UDATA tableSize = (J9_WALKBACK_INTERN_TABLE_SIZE * sizeof(J9WalkbackInternEntry)) + (J9_WALKBACK_DEPTH_CACHE_SIZE * sizeof(J9WalkbackDepthEntry));
+				vm->walkbackInternTable = j9mem_allocate_memory(tableSize, J9MEM_CATEGORY_VM);
+				if (NULL == vm->walkbackInternTable) {
+					goto _error;
+				}
+				memset(vm->walkbackInternTable, 0, tableSize);
+				vm->walkbackDepthCache = (J9WalkbackDepthEntry *)(vm->walkbackInternTable + J9_WALKBACK_INTERN_TABLE_SIZE);
+			}
+
+			if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_COMPRESS_ROM_CLASS_DEBUG_INFO)) {
+				if (0 != initializeCompressedDebugInfo(vm)) {
+					goto _error;
+				}
+			}
+
 			if (NULL == (vm->classLoadingStackPool = pool_new(sizeof(J9StackElement),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(vm->portLibrary))))
 				goto _error;
 
@@ -3179,6 +3220,36 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA noInternStackTraces = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOINTERNSTACKTRACES, NULL);
+		IDATA internStackTraces = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXINTERNSTACKTRACES, NULL);
+		if (internStackTraces > noInternStackTraces) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_INTERN_STACK_TRACES;
+		} else if (internStackTraces < noInternStackTraces) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_INTERN_STACK_TRACES;
+		}
+	}
+
+	{
+		IDATA noCompressDebugInfo = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOCOMPRESSROMCLASSDEBUGINFO, NULL);
+		IDATA compressDebugInfo = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXCOMPRESSROMCLASSDEBUGINFO, NULL);
+		if (compressDebugInfo > noCompressDebugInfo) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_COMPRESS_ROM_CLASS_DEBUG_INFO;
+		} else if (compressDebugInfo < noCompressDebugInfo) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_COMPRESS_ROM_CLASS_DEBUG_INFO;
+		}
+	}
+
+	{
+		IDATA noMapClassFileData = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOMAPCLASSFILEDATA, NULL);
+		IDATA mapClassFileData = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXMAPCLASSFILEDATA, NULL);
+		if (noMapClassFileData > mapClassFileData) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING;
+		} else if (noMapClassFileData < mapClassFileData) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_DISABLE_CLASS_FILE_MAPPING;
+		}
+	}
+
 	{
 		IDATA alwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXALWAYSCOPYJNICRITICAL, NULL);
 		IDATA noAlwaysCopyJNICritical = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOALWAYSCOPYJNICRITICAL, NULL);
@@ -287,6 +287,70 @@ objectMonitorEnter(J9VMThread* vmStruct, j9object_t object)
 
 #if defined (J9VM_THR_LOCK_RESERVATION)
 
+/**
+ * Handshake function for cancelLockReservation: unreserve vmStruct->blockingEnterObject
+ * while its reserving thread is halted.
+ *
+ * @param[in] vmStruct the current J9VMThread
+ * @param[in] reservationOwner the halted thread which held the reservation
+ * @param[in] userData unused
+ */
+static void
+unreserveLockForOwner(J9VMThread* vmStruct, J9VMThread* reservationOwner, void *userData)
+{
+	j9object_t object = NULL;
+	j9objectmonitor_t oldLock = 0;
+	j9objectmonitor_t newLock = 0;
+	j9objectmonitor_t *lockEA = NULL;
+
+	/* refresh the object pointer, since we may have released VM access */
+	object = vmStruct->blockingEnterObject;
+	if (!LN_HAS_LOCKWORD(vmStruct,object)) {
+		J9ObjectMonitor *objectMonitor = monitorTableAt(vmStruct, object);
+
+		Assert_VM_true(objectMonitor != NULL);
+
+		lockEA = &objectMonitor->alternateLockword;
+	} else {
+		lockEA = J9OBJECT_MONITOR_EA(vmStruct, object);
+	}
+
+	/* swap in an unreserved lock word */
+	/* (must use atomics since another thread might be doing this too) */
+	oldLock = J9_LOAD_LOCKWORD(vmStruct, lockEA);
+
+	/* must verify that the halted thread still owns the reservation */
+	if ( J9_FLATLOCK_OWNER(oldLock) == reservationOwner ) {
+		if (oldLock & OBJECT_HEADER_LOCK_RESERVED) {
+			if ( (oldLock & OBJECT_HEADER_LOCK_RECURSION_MASK) > 0 ) {
+				/* if the lock is acquired recursively, decrement the count and remove the reserved bit */
+				newLock = oldLock - OBJECT_HEADER_LOCK_RESERVED - OBJECT_HEADER_LOCK_FIRST_RECURSION_BIT;
+				Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == J9_FLATLOCK_COUNT(newLock));
+			} else {
+				/* otherwise clear the lock completely */
+				newLock = 0;
+				Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == 0);
+			}
+
+			/* TODO: Move file to C++, use VM_ObjectMonitor::compareAndSwapLockWord */
+			if (J9VMTHREAD_COMPRESS_OBJECT_REFERENCES(vmStruct)) {
+				compareAndSwapU32((uint32_t*)lockEA, (uint32_t)oldLock, (uint32_t)newLock);
+			} else {
+				compareAndSwapUDATA((uintptr_t*)lockEA, (uintptr_t)oldLock, (uintptr_t)newLock);
+			}
+
+			/* 
+			 * CAS can only fail if another canceller has modified the lockword, in which case the
+			 * object is either no longer reserved or reserved by a different thread.
+			 * Such cases should be detected by the calling function when it re-attempts to enter the monitor.
+			 */
+
+			/* Transition from Reserved to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
+			incrementCancelCounter(J9OBJECT_CLAZZ(vmStruct, object));
+		}
+	}
+}
+
 void
 cancelLockReservation(J9VMThread* vmStruct)
 {
@@ -310,64 +374,12 @@ cancelLockReservation(J9VMThread* vmStruct)
 	lock = J9_LOAD_LOCKWORD(vmStruct, lockEA);
 
 	if ( (lock & (OBJECT_HEADER_LOCK_INFLATED | OBJECT_HEADER_LOCK_RESERVED)) == OBJECT_HEADER_LOCK_RESERVED) {
-		j9objectmonitor_t oldLock = 0;
-		j9objectmonitor_t newLock = 0;
 		J9VMThread* reservationOwner = J9_FLATLOCK_OWNER(lock);
 
 		Trc_VM_cancelLockReservation_reservationOwner(vmStruct, reservationOwner);
 
-		/* halt the reserving thread */
-		haltThreadForInspection(vmStruct, reservationOwner);
-
-		/* refresh the object pointer, since we may have released VM access */
-		object = vmStruct->blockingEnterObject;
-		if (!LN_HAS_LOCKWORD(vmStruct,object)) {
-			J9ObjectMonitor *objectMonitor = monitorTableAt(vmStruct, object);
-
-			Assert_VM_true(objectMonitor != NULL);
-
-			lockEA = &objectMonitor->alternateLockword;
-		} else {
-			lockEA = J9OBJECT_MONITOR_EA(vmStruct, object);
-		}
-
-		/* swap in an unreserved lock word */
-		/* (must use atomics since another thread might be doing this too) */
-		oldLock = J9_LOAD_LOCKWORD(vmStruct, lockEA);
-
-		/* must verify that the halted thread still owns the reservation */
-		if ( J9_FLATLOCK_OWNER(oldLock) == reservationOwner ) {
-			if (oldLock & OBJECT_HEADER_LOCK_RESERVED) {
-				if ( (oldLock & OBJECT_HEADER_LOCK_RECURSION_MASK) > 0 ) {
-					/* if the lock is acquired recursively, decrement the count and remove the reserved bit */
-					newLock = oldLock - OBJECT_HEADER_LOCK_RESERVED - OBJECT_HEADER_LOCK_FIRST_RECURSION_BIT;
-					Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == J9_FLATLOCK_COUNT(newLock));
-				} else {
-					/* otherwise clear the lock completely */
-					newLock = 0;
-					Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == 0);
-				}
-
-				/* TODO: Move file to C++, use VM_ObjectMonitor::compareAndSwapLockWord */
-				if (J9VMTHREAD_COMPRESS_OBJECT_REFERENCES(vmStruct)) {
-					compareAndSwapU32((uint32_t*)lockEA, (uint32_t)oldLock, (uint32_t)newLock);
-				} else {
-					compareAndSwapUDATA((uintptr_t*)lockEA, (uintptr_t)oldLock, (uintptr_t)newLock);
-				}
-
-				/* 
-				 * CAS can only fail if another canceller has modified the lockword, in which case the
-				 * object is either no longer reserved or reserved by a different thread.
-				 * Such cases should be detected by the calling function when it re-attempts to enter the monitor.
-				 */
-
-				/* Transition from Reserved to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
-				incrementCancelCounter(J9OBJECT_CLAZZ(vmStruct, object));
-			}
-		}
-
-		/* resume the reserving thread */
-		resumeThreadForInspection(vmStruct, reservationOwner);
+		/* only the reserving thread needs to be stopped to unreserve the lock */
+		handshakeThread(vmStruct, reservationOwner, unreserveLockForOwner, NULL);
 	}
 
 	Trc_VM_cancelLockReservation_Exit(vmStruct);
@@ -400,6 +412,11 @@ cancelLockReservation(J9VMThread* vmStruct)
 IDATA 
 objectMonitorDestroy(J9JavaVM *vm, J9VMThread* vmThread, omrthread_monitor_t monitor)
 {
+	/* The GC has just removed the entry from the monitor table. Some collectors (e.g. Metronome)
+	 * let mutators run again before the scan of the monitor tables is complete, so the lock-free
+	 * index is emptied now and stays unused until objectMonitorDestroyComplete.
+	 */
+	invalidateMonitorTableIndex(vm);
 	return (IDATA)omrthread_monitor_destroy_nolock(vmThread->osThread, monitor);
 }
 
@@ -417,6 +434,8 @@ objectMonitorDestroy(J9JavaVM *vm, J9VMThread* vmThread, omrthread_monitor_t mon
 void
 objectMonitorDestroyComplete(J9JavaVM *vm, J9VMThread *vmThread)
 {
+	/* Nothing was published while the index was invalid, so it is empty and safe to use again */
+	vm->monitorTableIndexStale = 0;
 	omrthread_monitor_flush_destroyed_monitor_list(vmThread->osThread);
 }
 
@@ -35,22 +35,20 @@
 */
 
 #ifdef MONTABLE_TRACING
-static UDATA hits, misses;
-#define HIT() hits++
-#define MISS() misses++
-#define TRACE(message) j9tty_printf(PORTLIB, "%s in monitorTableAt in %p. Monitor=%p. Monitor-count=%d. Cache=%p (%d/%d)\n", (message), vmStruct, monitor, hashTableGetCount(vm->monitorTable), vmStruct->eventReportData1, hits, hits + misses);
+#define TRACE(message) j9tty_printf(PORTLIB, "%s in monitorTableAt in %p. Object=%p. Cache hits=%zu, index hits=%zu, misses=%zu\n", (message), vmStruct, object, vmStruct->monitorTableCacheHits, vmStruct->monitorTableIndexHits, vmStruct->monitorTableMisses);
 #else
-#define HIT()
-#define MISS()
 #define TRACE(message)
 #endif
 
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
+#define J9_MONITOR_TABLE_INDEX_SLOT(hash) ((UDATA)(hash) & (J9VM_MONITOR_TABLE_INDEX_SIZE - 1))
 
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
 static UDATA hashMonitorHash (void *key, void *userData);
 static J9HashTable* createMonitorTable(J9JavaVM *vm, char *tableName);
+static J9ObjectMonitor* monitorTableIndexFind(J9JavaVM *vm, j9object_t object, U_32 hash);
+static void monitorTableIndexAdd(J9JavaVM *vm, J9ObjectMonitor *objectMonitor);
 
 
 static UDATA
@@ -93,6 +91,86 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
 }
 
 
+/**
+ * Search the monitor table index without locking.
+ *
+ * The index is a fixed size, open addressed array of pointers to entries in the monitor tables.
+ * Entries are only added under the monitorTableMutex. The GC empties the index, while no thread
+ * has VM access, before it frees the first monitor table entry of a collection, and the index is
+ * neither searched nor filled again until the monitor table scan is complete (see
+ * invalidateMonitorTableIndex), so any entry read here remains valid for as long as the caller
+ * holds VM access.
+ *
+ * @param vm		the vm
+ * @param object	the object whose monitor is wanted
+ * @param hash		the hash code of object
+ *
+ * @return the J9ObjectMonitor for object, or NULL if it is not in the index
+ */
+static J9ObjectMonitor*
+monitorTableIndexFind(J9JavaVM *vm, j9object_t object, U_32 hash)
+{
+	J9ObjectMonitor * volatile *index = vm->monitorTableIndex;
+	UDATA slot = J9_MONITOR_TABLE_INDEX_SLOT(hash);
+	UDATA probe = 0;
+
+	if (0 != vm->monitorTableIndexStale) {
+		return NULL;
+	}
+	for (probe = 0; probe < J9VM_MONITOR_TABLE_INDEX_PROBES; probe++) {
+		J9ObjectMonitor *objectMonitor = index[J9_MONITOR_TABLE_INDEX_SLOT(slot + probe)];
+		if (NULL == objectMonitor) {
+			break;
+		}
+		if ((objectMonitor->hash == hash)
+		&& (J9WEAKROOT_OBJECT_LOAD_VM(vm, &((J9ThreadAbstractMonitor*)objectMonitor->monitor)->userData) == object)
+		) {
+			return objectMonitor;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Publish a monitor table entry in the monitor table index. If all of the slots the entry
+ * may occupy are in use, the first one is replaced. Nothing is published while the GC is
+ * clearing the monitor tables.
+ *
+ * @param vm			the vm
+ * @param objectMonitor	an entry in one of the monitor tables
+ *
+ * @pre the caller must hold the monitorTableMutex
+ */
+static void
+monitorTableIndexAdd(J9JavaVM *vm, J9ObjectMonitor *objectMonitor)
+{
+	J9ObjectMonitor * volatile *index = vm->monitorTableIndex;
+	UDATA slot = J9_MONITOR_TABLE_INDEX_SLOT(objectMonitor->hash);
+	UDATA probe = 0;
+
+	if (0 != vm->monitorTableIndexStale) {
+		return;
+	}
+	/* make sure the entry is fully initialized before other threads can see it */
+	issueWriteBarrier();
+	for (probe = 0; probe < J9VM_MONITOR_TABLE_INDEX_PROBES; probe++) {
+		UDATA probeSlot = J9_MONITOR_TABLE_INDEX_SLOT(slot + probe);
+		if ((NULL == index[probeSlot]) || (objectMonitor == index[probeSlot])) {
+			index[probeSlot] = objectMonitor;
+			return;
+		}
+	}
+	index[slot] = objectMonitor;
+}
+
+void
+invalidateMonitorTableIndex(J9JavaVM* vm)
+{
+	if ((0 == vm->monitorTableIndexStale) && (NULL != vm->monitorTableIndex)) {
+		memset((void *)vm->monitorTableIndex, 0, sizeof(J9ObjectMonitor *) * J9VM_MONITOR_TABLE_INDEX_SIZE);
+		vm->monitorTableIndexStale = 1;
+	}
+}
 
 /**
  * Creates the monitor hashtable
@@ -144,6 +222,13 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
+
+	vm->monitorTableIndex = (J9ObjectMonitor **)j9mem_allocate_memory(sizeof(J9ObjectMonitor *) * J9VM_MONITOR_TABLE_INDEX_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableIndex) {
+		return -1;
+	}
+	memset((void *)vm->monitorTableIndex, 0, sizeof(J9ObjectMonitor *) * J9VM_MONITOR_TABLE_INDEX_SIZE);
+	vm->monitorTableIndexStale = 0;
 	
 	vm->monitorTableList = NULL;
 
@@ -194,6 +279,12 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableIndex) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		j9mem_free_memory((void *)vm->monitorTableIndex);
+		vm->monitorTableIndex = NULL;
+	}
+
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -254,19 +345,30 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	 * but not triggering a copy) on userData slot.
 	 */
 	if ((objectMonitor != NULL) && (J9WEAKROOT_OBJECT_LOAD_VM(vm, &((J9ThreadAbstractMonitor*)objectMonitor->monitor)->userData) == object)) {
-		HIT();
+		vmStruct->monitorTableCacheHits += 1;
 		TRACE("Cache hit");
 		Trc_VM_monitorTableAt_CacheHit_Exit(vmStruct, objectMonitor);
 		return objectMonitor;
 	} else {
 		Trc_VM_monitorTableAtCacheMiss(vmStruct, J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(J9OBJECT_CLAZZ(vmStruct, object)->romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(J9OBJECT_CLAZZ(vmStruct, object)->romClass)), object);
-		MISS();
 	}
 
 	/* Create a "fake" monitor just to probe the hash-table */
 	key_monitor.userData = (UDATA) object;
 	key_objectMonitor.monitor = (omrthread_monitor_t) &key_monitor;
 	key_objectMonitor.hash = objectHashCode(vm, object);
+
+	/* Most monitors which miss the thread cache have already been published in the index */
+	objectMonitor = monitorTableIndexFind(vm, object, key_objectMonitor.hash);
+	if (NULL != objectMonitor) {
+		vmStruct->monitorTableIndexHits += 1;
+		TRACE("Index hit");
+		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+		Trc_VM_monitorTableAt_IndexHit_Exit(vmStruct, objectMonitor);
+		return objectMonitor;
+	}
+	vmStruct->monitorTableMisses += 1;
+
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
 
@@ -314,6 +416,10 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
 				key_objectMonitor.monitor = monitor;
+				/* start with the full try enter yield budget until the monitor has a history */
+				key_objectMonitor.spinYieldAverage = (vm->thrMaxTryEnterYieldsBeforeBlocking << J9_OBJECT_MONITOR_SPIN_AVERAGE_SHIFT) / 2;
+				key_objectMonitor.spinAcquireCount = 0;
+				key_objectMonitor.spinBlockCount = 0;
 
 #ifdef J9VM_THR_SMART_DEFLATION
 				key_objectMonitor.proDeflationCount = 0;
@@ -335,6 +441,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	}
 
 	if (NULL != objectMonitor) {
+		monitorTableIndexAdd(vm, objectMonitor);
 		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
 	}
 
@@ -0,0 +1,486 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include "j9.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "hashtable_api.h"
+#include "vm_internal.h"
+#include "ut_j9vm.h"
+#include "zlib.h"
+
+/*
+ * Compressed storage of ROM class method debug info (-XX:+CompressROMClassDebugInfo).
+ *
+ * Line number tables are only read when a stack trace is printed or a debugger asks for them, yet
+ * they are a large part of every ROM class. When the option is enabled, the ROMClassBuilder leaves
+ * the line number only debug info of the methods of classes which can not be shared, redefined or
+ * retransformed out of the ROM class, and hands it to storeCompressedROMClassDebugInfo, which keeps
+ * it deflated until the defining class loader is freed. The records are found by ROM class through a
+ * VM wide hash table, and each class loader also lists its own records so that they can be freed
+ * without walking the whole table.
+ *
+ * The debug info of a class is inflated as a whole on first use. The inflated copies are kept in a
+ * most recently used list bounded by J9_DECODED_DEBUG_INFO_CACHE_BYTES, and an inflated copy is
+ * pinned from acquireCompressedMethodDebugInfo until the matching releaseCompressedMethodDebugInfo
+ * so that it can not be freed while in use. All of the state is guarded by compressedDebugInfoMutex.
+ */
+
+static UDATA compressedDebugInfoHash(void *entry, void *userData);
+static UDATA compressedDebugInfoEquals(void *leftEntry, void *rightEntry, void *userData);
+static J9CompressedDebugInfo *findCompressedDebugInfo(J9JavaVM *vm, J9ROMClass *romClass);
+static J9DecodedDebugInfo *inflateCompressedDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, U_8 *compressedData, U_32 compressedSize, U_32 uncompressedSize, U_32 methodCount);
+static void unlinkDecodedDebugInfo(J9JavaVM *vm, J9DecodedDebugInfo *decoded);
+static void linkDecodedDebugInfo(J9JavaVM *vm, J9DecodedDebugInfo *decoded);
+static void trimDecodedDebugInfo(J9JavaVM *vm);
+static J9MethodDebugInfo *findDecodedMethodDebugInfo(J9DecodedDebugInfo *decoded, J9ROMMethod *romMethod);
+static void freeCompressedDebugInfoEntry(J9JavaVM *vm, J9CompressedDebugInfo *compressed);
+static void unlinkLoaderCompressedDebugInfo(J9CompressedDebugInfo *compressed);
+
+
+static UDATA
+compressedDebugInfoHash(void *entry, void *userData)
+{
+	J9CompressedDebugInfo *compressed = *(J9CompressedDebugInfo **) entry;
+
+	return (UDATA) compressed->romClass >> 3;
+}
+
+
+static UDATA
+compressedDebugInfoEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	J9CompressedDebugInfo *left = *(J9CompressedDebugInfo **) leftEntry;
+	J9CompressedDebugInfo *right = *(J9CompressedDebugInfo **) rightEntry;
+
+	return left->romClass == right->romClass;
+}
+
+
+IDATA
+initializeCompressedDebugInfo(J9JavaVM *vm)
+{
+	if (0 != omrthread_monitor_init_with_name(&vm->compressedDebugInfoMutex, 0, "VM compressed debug info")) {
+		return -1;
+	}
+	vm->compressedDebugInfoTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9CompressedDebugInfo *), sizeof(J9CompressedDebugInfo *), 0, J9MEM_CATEGORY_CLASSES, compressedDebugInfoHash, compressedDebugInfoEquals, NULL, vm);
+	if (NULL == vm->compressedDebugInfoTable) {
+		return -1;
+	}
+	return 0;
+}
+
+
+/*
+ * Must be called with compressedDebugInfoMutex held.
+ */
+static J9CompressedDebugInfo *
+findCompressedDebugInfo(J9JavaVM *vm, J9ROMClass *romClass)
+{
+	J9CompressedDebugInfo exemplar;
+	J9CompressedDebugInfo *exemplarPtr = &exemplar;
+	J9CompressedDebugInfo **entry = NULL;
+
+	exemplar.romClass = romClass;
+	entry = hashTableFind(vm->compressedDebugInfoTable, &exemplarPtr);
+	return (NULL == entry) ? NULL : *entry;
+}
+
+
+UDATA
+storeCompressedROMClassDebugInfo(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, U_8 *data, UDATA dataSize, U_32 methodCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9CompressedDebugInfo *compressed = NULL;
+	J9CompressedDebugInfo *previous = NULL;
+	z_stream stream;
+	UDATA bound = 0;
+	UDATA rc = 1;
+
+	if (NULL == vm->compressedDebugInfoTable) {
+		return rc;
+	}
+
+	memset(&stream, 0, sizeof(stream));
+	if (Z_OK != deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY)) {
+		return rc;
+	}
+	bound = deflateBound(&stream, (uLong) dataSize);
+	compressed = j9mem_allocate_memory(sizeof(J9CompressedDebugInfo) + bound, J9MEM_CATEGORY_CLASSES);
+	if (NULL != compressed) {
+		compressed->romClass = romClass;
+		compressed->classLoader = classLoader;
+		compressed->loaderPrevious = NULL;
+		compressed->loaderNext = NULL;
+		compressed->compressedData = (U_8 *) (compressed + 1);
+		compressed->uncompressedSize = (U_32) dataSize;
+		compressed->methodCount = methodCount;
+		compressed->decoded = NULL;
+
+		stream.next_in = data;
+		stream.avail_in = (uInt) dataSize;
+		stream.next_out = compressed->compressedData;
+		stream.avail_out = (uInt) bound;
+		if (Z_STREAM_END == deflate(&stream, Z_FINISH)) {
+			compressed->compressedSize = (U_32) stream.total_out;
+			rc = 0;
+		}
+	}
+	deflateEnd(&stream);
+
+	if (0 != rc) {
+		j9mem_free_memory(compressed);
+		return rc;
+	}
+
+	omrthread_monitor_enter(vm->compressedDebugInfoMutex);
+	/* A ROM class which failed to be defined may have left a record at the same address behind */
+	previous = findCompressedDebugInfo(vm, romClass);
+	if (NULL != previous) {
+		hashTableRemove(vm->compressedDebugInfoTable, &previous);
+		unlinkLoaderCompressedDebugInfo(previous);
+		freeCompressedDebugInfoEntry(vm, previous);
+	}
+	if (NULL == hashTableAdd(vm->compressedDebugInfoTable, &compressed)) {
+		j9mem_free_memory(compressed);
+		rc = 1;
+	} else {
+		compressed->loaderNext = classLoader->compressedDebugInfoList;
+		if (NULL != classLoader->compressedDebugInfoList) {
+			classLoader->compressedDebugInfoList->loaderPrevious = compressed;
+		}
+		classLoader->compressedDebugInfoList = compressed;
+		/* The record header and the deflate bound slack are counted, as they are what is really spent */
+		classLoader->compressedDebugInfoInlineBytes += dataSize - (methodCount * sizeof(U_32));
+		classLoader->compressedDebugInfoStoredBytes += sizeof(J9CompressedDebugInfo) + bound;
+	}
+	omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+
+	return rc;
+}
+
+
+/*
+ * Inflate the debug info of a class into a new J9DecodedDebugInfo and find the ROM method of each record.
+ * Called without compressedDebugInfoMutex held, the compressed data is not freed while the class is alive.
+ */
+static J9DecodedDebugInfo *
+inflateCompressedDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, U_8 *compressedData, U_32 compressedSize, U_32 uncompressedSize, U_32 methodCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA size = sizeof(J9DecodedDebugInfo) + (methodCount * sizeof(J9DecodedDebugInfoMethod)) + uncompressedSize;
+	J9DecodedDebugInfo *decoded = j9mem_allocate_memory(size, J9MEM_CATEGORY_CLASSES);
+	z_stream stream;
+	BOOLEAN inflated = FALSE;
+
+	if (NULL == decoded) {
+		return NULL;
+	}
+	memset(decoded, 0, sizeof(J9DecodedDebugInfo));
+	decoded->size = size;
+	decoded->methods = (J9DecodedDebugInfoMethod *) (decoded + 1);
+	decoded->data = (U_8 *) (decoded->methods + methodCount);
+	decoded->dataEnd = decoded->data + uncompressedSize;
+
+	memset(&stream, 0, sizeof(stream));
+	if (Z_OK == inflateInit2(&stream, -MAX_WBITS)) {
+		stream.next_in = compressedData;
+		stream.avail_in = compressedSize;
+		stream.next_out = decoded->data;
+		stream.avail_out = uncompressedSize;
+		inflated = (Z_STREAM_END == inflate(&stream, Z_FINISH)) && (uncompressedSize == stream.total_out);
+		inflateEnd(&stream);
+	}
+
+	if (inflated) {
+		/* Records are in ROM method order, so the ROM methods are found in a single walk */
+		J9ROMMethod *romMethod = J9ROMCLASS_ROMMETHODS(romClass);
+		U_32 romMethodIndex = 0;
+		U_8 *cursor = decoded->data;
+		U_32 i = 0;
+
+		for (i = 0; i < methodCount; i++) {
+			U_32 methodIndex = *(U_32 *) cursor;
+			J9MethodDebugInfo *methodDebugInfo = (J9MethodDebugInfo *) (cursor + sizeof(U_32));
+
+			while ((romMethodIndex < methodIndex) && (romMethodIndex < romClass->romMethodCount)) {
+				romMethod = nextROMMethod(romMethod);
+				romMethodIndex += 1;
+			}
+			if (romMethodIndex != methodIndex) {
+				inflated = FALSE;
+				break;
+			}
+			decoded->methods[i].romMethod = romMethod;
+			decoded->methods[i].methodDebugInfo = methodDebugInfo;
+			/* The low tagged size of inline debug info includes the size field itself */
+			cursor += sizeof(U_32) + (methodDebugInfo->srpToVarInfo & ~(J9SRP)1);
+		}
+	}
+
+	if (!inflated) {
+		j9mem_free_memory(decoded);
+		decoded = NULL;
+	}
+	return decoded;
+}
+
+
+/*
+ * Must be called with compressedDebugInfoMutex held.
+ */
+static void
+unlinkDecodedDebugInfo(J9JavaVM *vm, J9DecodedDebugInfo *decoded)
+{
+	if (NULL == decoded->lruPrevious) {
+		vm->decodedDebugInfoHead = decoded->lruNext;
+	} else {
+		decoded->lruPrevious->lruNext = decoded->lruNext;
+	}
+	if (NULL == decoded->lruNext) {
+		vm->decodedDebugInfoTail = decoded->lruPrevious;
+	} else {
+		decoded->lruNext->lruPrevious = decoded->lruPrevious;
+	}
+	decoded->lruPrevious = NULL;
+	decoded->lruNext = NULL;
+}
+
+
+/*
+ * Must be called with compressedDebugInfoMutex held.
+ */
+static void
+linkDecodedDebugInfo(J9JavaVM *vm, J9DecodedDebugInfo *decoded)
+{
+	decoded->lruPrevious = NULL;
+	decoded->lruNext = vm->decodedDebugInfoHead;
+	if (NULL == vm->decodedDebugInfoHead) {
+		vm->decodedDebugInfoTail = decoded;
+	} else {
+		vm->decodedDebugInfoHead->lruPrevious = decoded;
+	}
+	vm->decodedDebugInfoHead = decoded;
+}
+
+
+/*
+ * Free the least recently used inflated debug info which is not pinned until the total fits the budget.
+ * Must be called with compressedDebugInfoMutex held.
+ */
+static void
+trimDecodedDebugInfo(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9DecodedDebugInfo *decoded = vm->decodedDebugInfoTail;
+
+	while ((vm->decodedDebugInfoBytes > J9_DECODED_DEBUG_INFO_CACHE_BYTES) && (NULL != decoded)) {
+		J9DecodedDebugInfo *previous = decoded->lruPrevious;
+		if (0 == decoded->pinCount) {
+			unlinkDecodedDebugInfo(vm, decoded);
+			decoded->compressed->decoded = NULL;
+			vm->decodedDebugInfoBytes -= decoded->size;
+			j9mem_free_memory(decoded);
+		}
+		decoded = previous;
+	}
+}
+
+
+static J9MethodDebugInfo *
+findDecodedMethodDebugInfo(J9DecodedDebugInfo *decoded, J9ROMMethod *romMethod)
+{
+	U_32 methodCount = decoded->compressed->methodCount;
+	U_32 i = 0;
+
+	for (i = 0; i < methodCount; i++) {
+		if (decoded->methods[i].romMethod == romMethod) {
+			return decoded->methods[i].methodDebugInfo;
+		}
+	}
+	return NULL;
+}
+
+
+J9MethodDebugInfo *
+acquireCompressedMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9ROMMethod *romMethod)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9CompressedDebugInfo *compressed = NULL;
+	J9DecodedDebugInfo *decoded = NULL;
+	J9MethodDebugInfo *methodDebugInfo = NULL;
+
+	if (NULL == vm->compressedDebugInfoTable) {
+		return NULL;
+	}
+
+	omrthread_monitor_enter(vm->compressedDebugInfoMutex);
+	compressed = findCompressedDebugInfo(vm, romClass);
+	if (NULL == compressed) {
+		omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+		return NULL;
+	}
+	decoded = compressed->decoded;
+	if (NULL == decoded) {
+		/* Inflate outside of the mutex, another thread may inflate the same class in the meantime */
+		U_8 *compressedData = compressed->compressedData;
+		U_32 compressedSize = compressed->compressedSize;
+		U_32 uncompressedSize = compressed->uncompressedSize;
+		U_32 methodCount = compressed->methodCount;
+
+		omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+		decoded = inflateCompressedDebugInfo(vm, romClass, compressedData, compressedSize, uncompressedSize, methodCount);
+		if (NULL == decoded) {
+			return NULL;
+		}
+		omrthread_monitor_enter(vm->compressedDebugInfoMutex);
+		if (NULL == compressed->decoded) {
+			decoded->compressed = compressed;
+			compressed->decoded = decoded;
+			vm->decodedDebugInfoBytes += decoded->size;
+		} else {
+			j9mem_free_memory(decoded);
+			decoded = compressed->decoded;
+			unlinkDecodedDebugInfo(vm, decoded);
+		}
+	} else {
+		unlinkDecodedDebugInfo(vm, decoded);
+	}
+	linkDecodedDebugInfo(vm, decoded);
+
+	methodDebugInfo = findDecodedMethodDebugInfo(decoded, romMethod);
+	if (NULL != methodDebugInfo) {
+		decoded->pinCount += 1;
+	}
+	trimDecodedDebugInfo(vm);
+	omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+
+	return methodDebugInfo;
+}
+
+
+void
+releaseCompressedMethodDebugInfo(J9JavaVM *vm, J9ROMClass *romClass, J9MethodDebugInfo *methodDebugInfo)
+{
+	J9CompressedDebugInfo *compressed = NULL;
+
+	if ((NULL == vm->compressedDebugInfoTable) || (NULL == methodDebugInfo)) {
+		return;
+	}
+
+	omrthread_monitor_enter(vm->compressedDebugInfoMutex);
+	compressed = findCompressedDebugInfo(vm, romClass);
+	if ((NULL != compressed) && (NULL != compressed->decoded)) {
+		J9DecodedDebugInfo *decoded = compressed->decoded;
+		if (((U_8 *) methodDebugInfo >= decoded->data) && ((U_8 *) methodDebugInfo < decoded->dataEnd)) {
+			Assert_VM_true(decoded->pinCount > 0);
+			decoded->pinCount -= 1;
+			if (0 == decoded->pinCount) {
+				trimDecodedDebugInfo(vm);
+			}
+		}
+	}
+	omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+}
+
+
+/*
+ * Remove a record from the list of its class loader.
+ * Must be called with compressedDebugInfoMutex held.
+ */
+static void
+unlinkLoaderCompressedDebugInfo(J9CompressedDebugInfo *compressed)
+{
+	if (NULL == compressed->loaderPrevious) {
+		compressed->classLoader->compressedDebugInfoList = compressed->loaderNext;
+	} else {
+		compressed->loaderPrevious->loaderNext = compressed->loaderNext;
+	}
+	if (NULL != compressed->loaderNext) {
+		compressed->loaderNext->loaderPrevious = compressed->loaderPrevious;
+	}
+	compressed->loaderPrevious = NULL;
+	compressed->loaderNext = NULL;
+}
+
+
+/*
+ * Must be called with compressedDebugInfoMutex held, or once no other thread can use the records.
+ */
+static void
+freeCompressedDebugInfoEntry(J9JavaVM *vm, J9CompressedDebugInfo *compressed)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9DecodedDebugInfo *decoded = compressed->decoded;
+
+	if (NULL != decoded) {
+		unlinkDecodedDebugInfo(vm, decoded);
+		vm->decodedDebugInfoBytes -= decoded->size;
+		j9mem_free_memory(decoded);
+	}
+	j9mem_free_memory(compressed);
+}
+
+
+void
+freeClassLoaderCompressedDebugInfo(J9JavaVM *vm, J9ClassLoader *classLoader)
+{
+	J9CompressedDebugInfo *compressed = NULL;
+
+	if ((NULL == vm->compressedDebugInfoTable) || (NULL == classLoader->compressedDebugInfoList)) {
+		return;
+	}
+
+	omrthread_monitor_enter(vm->compressedDebugInfoMutex);
+	compressed = classLoader->compressedDebugInfoList;
+	while (NULL != compressed) {
+		J9CompressedDebugInfo *next = compressed->loaderNext;
+		hashTableRemove(vm->compressedDebugInfoTable, &compressed);
+		freeCompressedDebugInfoEntry(vm, compressed);
+		compressed = next;
+	}
+	classLoader->compressedDebugInfoList = NULL;
+	classLoader->compressedDebugInfoInlineBytes = 0;
+	classLoader->compressedDebugInfoStoredBytes = 0;
+	omrthread_monitor_exit(vm->compressedDebugInfoMutex);
+}
+
+
+void
+freeCompressedDebugInfo(J9JavaVM *vm)
+{
+	if (NULL != vm->compressedDebugInfoTable) {
+		J9HashTableState walkState;
+		J9CompressedDebugInfo **entry = hashTableStartDo(vm->compressedDebugInfoTable, &walkState);
+		while (NULL != entry) {
+			freeCompressedDebugInfoEntry(vm, *entry);
+			entry = hashTableNextDo(&walkState);
+		}
+		hashTableFree(vm->compressedDebugInfoTable);
+		vm->compressedDebugInfoTable = NULL;
+	}
+	if (NULL != vm->compressedDebugInfoMutex) {
+		omrthread_monitor_destroy(vm->compressedDebugInfoMutex);
+		vm->compressedDebugInfoMutex = NULL;
+	}
+}
@@ -83,8 +83,8 @@ static void walkBytecodeFrame (J9StackWalkState * walkState);
 static void walkDescribedPushes (J9StackWalkState * walkState, UDATA * highestSlot, UDATA slotCount, U_32 * descriptionSlots, UDATA argCount);
 static void walkObjectPushes (J9StackWalkState * walkState);
 static void walkPushedJNIRefs (J9StackWalkState * walkState);
-static void getStackMap (J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 *result);
-static void getLocalsMap (J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, U_32 * result, UDATA argTempCount, UDATA alwaysLocalMap);
+static void getStackMap (J9StackWalkState * walkState, J9ClassLoader * classLoader, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 *result);
+static void getLocalsMap (J9StackWalkState * walkState, J9ClassLoader * classLoader, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, U_32 * result, UDATA argTempCount, UDATA alwaysLocalMap);
 static UDATA allocateCache (J9StackWalkState * walkState);
 static void dropToCurrentFrame (J9StackWalkState * walkState);
 
@@ -827,6 +827,10 @@ walkBytecodeFrameSlots(J9StackWalkState *walkState, J9Method *method, UDATA offs
 	U_32 *result = &smallResult;
 	U_32 *globalBuffer = NULL;
 	UDATA numberOfMappedLocals = numberOfLocals;
+	/* The ROM classes of anonymous and hidden classes belong to the anonClassLoader and are freed
+	 * one class at a time, so their maps must not be cached in the host loader, which outlives them.
+	 */
+	J9ClassLoader *mapCacheLoader = J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(ramClass), J9ClassIsAnonymous) ? NULL : ramClass->classLoader;
 
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 3, "\tBytecode index = %d\n", offsetPC);
@@ -862,7 +866,7 @@ walkBytecodeFrameSlots(J9StackWalkState *walkState, J9Method *method, UDATA offs
 	}
 
 	if (0 != numberOfMappedLocals) {
-		getLocalsMap(walkState, romClass, romMethod, offsetPC, result, numberOfMappedLocals, alwaysLocalMap);
+		getLocalsMap(walkState, mapCacheLoader, romClass, romMethod, offsetPC, result, numberOfMappedLocals, alwaysLocalMap);
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 		swPrintf(walkState, 4, "\tLocals starting at %p for %d slots\n", localBase, numberOfMappedLocals);
 #endif
@@ -872,7 +876,7 @@ walkBytecodeFrameSlots(J9StackWalkState *walkState, J9Method *method, UDATA offs
 	}
 
 	if (0 != pendingStackHeight) {
-		getStackMap(walkState, romClass, romMethod, offsetPC, pendingStackHeight, result);
+		getStackMap(walkState, mapCacheLoader, romClass, romMethod, offsetPC, pendingStackHeight, result);
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 		swPrintf(walkState, 4, "\tPending stack starting at %p for %d slots\n", pendingBase, pendingStackHeight);
 #endif
@@ -1431,7 +1435,7 @@ static void emptySniffAndWhackIterator(J9VMThread * currentThread, J9StackWalkSt
 
 
 static void 
-getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, U_32 * result, UDATA argTempCount, UDATA alwaysLocalMap)
+getLocalsMap(J9StackWalkState * walkState, J9ClassLoader * classLoader, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, U_32 * result, UDATA argTempCount, UDATA alwaysLocalMap)
 {
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
@@ -1465,7 +1469,7 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
 #endif
-	errorCode = vm->localMapFunction(PORTLIB, romClass, romMethod, offsetPC, result, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	errorCode = j9mapcache_LocalBitsForPC(vm, classLoader, romClass, romMethod, offsetPC, result, argTempCount);
 
 	if (errorCode < 0) {
 		/* Local map failed, result = %p - aborting VM - needs new message TBD */
@@ -1482,12 +1486,12 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 
 
 static void 
-getStackMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 *result) 
+getStackMap(J9StackWalkState * walkState, J9ClassLoader * classLoader, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA offsetPC, UDATA pushCount, U_32 *result) 
 {
 	PORT_ACCESS_FROM_WALKSTATE(walkState);
 	IDATA errorCode;
 
-	errorCode = j9stackmap_StackBitsForPC(PORTLIB, offsetPC, romClass, romMethod, result, pushCount, walkState->walkThread->javaVM, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	errorCode = j9mapcache_StackBitsForPC(walkState->walkThread->javaVM, classLoader, romClass, romMethod, offsetPC, result, pushCount);
 	if (errorCode < 0) {
 		/* Local map failed, result = %p - aborting VM */
 		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_STACK_MAP_FAILED, errorCode);
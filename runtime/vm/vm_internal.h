@@ -173,6 +173,37 @@ void
 deleteStatistics (J9JavaVM* javaVM);
 
 
+/* ---------------- romdebuginfo.c ---------------- */
+
+/**
+* @brief
+* Create the table of compressed ROM class debug info (-XX:+CompressROMClassDebugInfo).
+* @param vm
+* @return 0 on success, -1 on failure
+*/
+IDATA
+initializeCompressedDebugInfo(J9JavaVM *vm);
+
+/**
+* @brief
+* Free the compressed debug info of the ROM classes defined by a class loader which is being freed.
+* @param vm
+* @param classLoader
+* @return void
+*/
+void
+freeClassLoaderCompressedDebugInfo(J9JavaVM *vm, J9ClassLoader *classLoader);
+
+/**
+* @brief
+* Free all remaining compressed debug info and the table holding it.
+* @param vm
+* @return void
+*/
+void
+freeCompressedDebugInfo(J9JavaVM *vm);
+
+
 /* ---------------- jnicsup.c ---------------- */
 /**
 * @brief
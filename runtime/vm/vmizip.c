@@ -45,6 +45,14 @@ vmizip_getZipEntryData(VMInterface * vmi, VMIZipFile * zipFile, VMIZipEntry * en
 	return zip_getZipEntryData(PORTLIB, (J9ZipFile *)zipFile, (J9ZipEntry *)entry, buffer, bufferSize);
 }
 
+I_32 
+vmizip_getZipEntryDataPointer(VMInterface * vmi, VMIZipFile * zipFile, VMIZipEntry * entry, U_8 ** data) 
+{
+	J9VMInterface* j9vmi = (J9VMInterface*)vmi;
+	PORT_ACCESS_FROM_JAVAVM(j9vmi->javaVM);
+	return zip_getZipEntryDataPointer(PORTLIB, (J9ZipFile *)zipFile, (J9ZipEntry *)entry, data);
+}
+
 I_32 
 vmizip_getZipEntryRawData(VMInterface * vmi, VMIZipFile * zipFile, VMIZipEntry * entry, U_8 * buffer, U_32 bufferSize, U_32 offset) 
 {
@@ -352,5 +360,6 @@ struct VMIZipFunctionTable VMIZipLibraryTable = {
 	vmizip_getZipEntryWithSize,
 	/* J9 specific, keep these at the end */
 	vmizip_getZipHookInterface,
+	vmizip_getZipEntryDataPointer,
     NULL
 };
@@ -506,6 +506,7 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 	vm->thrMaxTryEnterYieldsBeforeBlocking = 45;
 	vm->thrNestedSpinning = 1;
 	vm->thrTryEnterNestedSpinning = 1;
+	vm->thrAdaptiveTryEnterSpinning = 1;
 	vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
 
 	if (cpus > 1) {
@@ -739,6 +740,16 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "adaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAdaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 0;
+			continue;
+		}
+
 
 		if (try_scan(&scan_start, "staggerStep=")) {
 			if (scan_udata(&scan_start, &vm->thrStaggerStep)) {
@@ -123,6 +123,8 @@ typedef struct J9ZipCacheInternal {
 	J9ZipCacheEntry *entry;
 	IDATA zipFileFd;
 	U_8 zipFileType;
+	BOOLEAN zipFileMmapFailed;
+	J9MmapHandle *zipFileMmap;
 } J9ZipCacheInternal;
 
 /**
@@ -169,6 +171,16 @@ void
 zipCache_invalidateCache(J9ZipCache * zipCache);
 
 
+/**
+* @brief
+* @param zipCache
+* @param mappedSize
+* @return U_8 *
+*/
+U_8 *
+zipCache_mapZipFile(J9ZipCache * zipCache, UDATA *mappedSize);
+
+
 #endif /* J9VM_OPT_ZIP_SUPPORT */ /* End File Level Build Flags */
 
 
@@ -45,7 +45,13 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
+
+/**
+ * Directories holding at least this many files (or subdirectories) are given a
+ * hashed index by zipCache_buildIndexes(). Smaller lists are searched linearly.
+ */
+#define ZIP_CACHE_INDEX_THRESHOLD 16
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
@@ -66,6 +72,11 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static J9ZipChunkHeader *zipCache_allocateChunkOfSize(J9PortLibrary * portLib, UDATA chunkSize);
+static UDATA zipCache_hashName(const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static J9ZipIndex *zipCache_reserveIndex(J9PortLibrary * portLib, J9ZipCacheEntry *zce, UDATA entryCount);
+static BOOLEAN zipCache_indexInsert(J9ZipIndex *index, UDATA hash, void *entry);
+static BOOLEAN zipCache_buildDirIndexes(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -122,6 +133,8 @@ J9ZipCache *zipCache_new(J9PortLibrary * portLib, char *zipName, IDATA zipNameLe
 	zci->entry = zce;
 	zci->zipFileFd = -1;
 	zci->zipFileType = ZIP_Unknown;
+	zci->zipFileMmapFailed = FALSE;
+	zci->zipFileMmap = NULL;
 
 	zci->info.portLib = portLib;
 	ZIP_SRP_SET(zce->currentChunk, chunk);
@@ -229,7 +242,8 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 	J9ZipChunkHeader *chunk = ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *);
 
 	while (chunk) {
-		sizeRequired += ACTUAL_CHUNK_SIZE - (chunk->endFree - chunk->beginFree);
+		/* index chunks may be larger than ACTUAL_CHUNK_SIZE, so count the used bytes directly */
+		sizeRequired += chunk->beginFree - (U_8 *)chunk;
 		chunk = ZIP_SRP_GET(chunk->next, J9ZipChunkHeader *);
 	}
 	if (sizeRequired) {
@@ -358,6 +372,11 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 
+	/* Rebuild the directory indexes inside the copy so they are persisted with it. The copy
+	 * needs no more space than the original entries, leaving room for the same indexes.
+	 * Any directory whose index does not fit is searched linearly. */
+	zipCache_buildDirIndexes(NULL, zce, &zce->root);
+
 	/* Null the currentChunk so it can't be free'd */
 	ZIP_SRP_SET_TO_NULL(zce->currentChunk);
 
@@ -776,6 +795,9 @@ void zipCache_kill(J9ZipCache * zipCache)
 	PORT_ACCESS_FROM_PORT(portLib);
 
 	zipCache_freeChunks(portLib, zce);
+	if (NULL != zci->zipFileMmap) {
+		j9mmap_unmap_file(zci->zipFileMmap);
+	}
 	if (-1 != zci->zipFileFd) {
 		j9file_close(zci->zipFileFd);
 	}
@@ -783,6 +805,44 @@ void zipCache_kill(J9ZipCache * zipCache)
 }
 
 
+/**
+ * Returns the base of a read-only mapping of the whole zip file, creating the mapping
+ * on first use. The mapping is released by zipCache_kill(), so pointers into it remain
+ * valid while any zip file using this cache is open. If the file cannot be mapped, the
+ * failure is remembered and NULL is returned from then on. The omrthread_global_monitor()
+ * must be held by the caller.
+ *
+ * @param[in] zipCache the zip cache
+ * @param[out] mappedSize the number of bytes mapped
+ *
+ * @return the base of the mapping, or NULL if the zip file is not mapped
+ */
+U_8 *
+zipCache_mapZipFile(J9ZipCache * zipCache, UDATA *mappedSize)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	J9ZipCacheEntry *zce = zci->entry;
+	PORT_ACCESS_FROM_PORT(zipCache->portLib);
+
+	if ((NULL == zci->zipFileMmap) && !zci->zipFileMmapFailed) {
+		if ((-1 == zci->zipFileFd) || (0 >= zce->zipFileSize)) {
+			zci->zipFileMmapFailed = TRUE;
+		} else {
+			zci->zipFileMmap = j9mmap_map_file(zci->zipFileFd, 0, (UDATA)zce->zipFileSize,
+					ZIP_SRP_GET(zce->zipFileName, const char *), J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+			if (NULL == zci->zipFileMmap) {
+				zci->zipFileMmapFailed = TRUE;
+			}
+		}
+	}
+	if (NULL == zci->zipFileMmap) {
+		return NULL;
+	}
+	*mappedSize = (UDATA)zce->zipFileSize;
+	return (U_8 *)zci->zipFileMmap->pointer;
+}
+
+
 
 
 /* Allocate a new J9ZipDirEntry and insert into dirEntry's dirList. */
@@ -790,6 +850,7 @@ void zipCache_kill(J9ZipCache * zipCache)
 J9ZipDirEntry *zipCache_addToDirList(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry * dirEntry, const char *namePtr, IDATA nameSize, BOOLEAN isClass)
 {
 	J9ZipDirEntry *entry;
+	J9ZipIndex *index;
 	J9ZipChunkHeader *chunk = ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *);
 	char *name;
 
@@ -812,6 +873,12 @@ J9ZipDirEntry *zipCache_addToDirList(J9PortLibrary * portLib, J9ZipCacheEntry *z
 	entry->zipFileOffset = IMPLICIT_ENTRY | (isClass ? ISCLASS_BIT : 0);
 	memcpy(name, namePtr, nameSize);
 	/* name[nameSize] is already zero (NUL) */
+
+	index = ZIP_SRP_GET(dirEntry->dirIndex, J9ZipIndex *);
+	if ((NULL != index) && !zipCache_indexInsert(index, zipCache_hashName(namePtr, nameSize, isClass), entry)) {
+		/* the index is full, fall back to searching the list */
+		ZIP_SRP_SET_TO_NULL(dirEntry->dirIndex);
+	}
 	return entry;
 }
 
@@ -826,6 +893,7 @@ J9ZipFileEntry *zipCache_addToFileList(J9PortLibrary *portLib, J9ZipCacheEntry *
 {
 	J9ZipFileEntry *entry;
 	J9ZipFileRecord *record;
+	J9ZipIndex *index;
 	J9ZipChunkHeader *chunk = ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *);
 	J9ZipDirEntry *chunkActiveDir = ZIP_SRP_GET(zce->chunkActiveDir, J9ZipDirEntry *);
 	char *name;
@@ -864,6 +932,12 @@ haveEntry:
 	memcpy(name, namePtr, nameSize);
 	entry->nameLength = nameSize;
 	entry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
+
+	index = ZIP_SRP_GET(dirEntry->fileIndex, J9ZipIndex *);
+	if ((NULL != index) && !zipCache_indexInsert(index, zipCache_hashName(namePtr, nameSize, isClass), entry)) {
+		/* the index is full, fall back to searching the list */
+		ZIP_SRP_SET_TO_NULL(dirEntry->fileIndex);
+	}
 	return entry;
 }
 
@@ -872,16 +946,25 @@ haveEntry:
 /* Allocate a new chunk and initialize its zipChunkHeader. */
 
 J9ZipChunkHeader *zipCache_allocateChunk(J9PortLibrary * portLib)
+{
+	return zipCache_allocateChunkOfSize(portLib, ACTUAL_CHUNK_SIZE);
+}
+
+
+
+/* Allocate a new chunk of chunkSize bytes, which may be larger than ACTUAL_CHUNK_SIZE. */
+
+static J9ZipChunkHeader *zipCache_allocateChunkOfSize(J9PortLibrary * portLib, UDATA chunkSize)
 {
 	J9ZipChunkHeader *chunk;
 	PORT_ACCESS_FROM_PORT(portLib);
 
-	chunk = (J9ZipChunkHeader *) j9mem_allocate_memory(ACTUAL_CHUNK_SIZE, J9MEM_CATEGORY_VM_JCL);
+	chunk = (J9ZipChunkHeader *) j9mem_allocate_memory(chunkSize, J9MEM_CATEGORY_VM_JCL);
 	if (!chunk)
 		return NULL;
-	memset(chunk, 0, ACTUAL_CHUNK_SIZE);
+	memset(chunk, 0, chunkSize);
 	chunk->beginFree = ((U_8 *)chunk) + sizeof(J9ZipChunkHeader);
-	chunk->endFree = ((U_8 *) chunk) + ACTUAL_CHUNK_SIZE;
+	chunk->endFree = ((U_8 *) chunk) + chunkSize;
 	return chunk;
 }
 
@@ -942,11 +1025,29 @@ zipCache_reserveEntry(J9ZipCacheEntry *zce, J9ZipChunkHeader * chunk, UDATA entr
 J9ZipDirEntry *zipCache_searchDirList(J9ZipDirEntry * dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
 {
 	J9ZipDirEntry *entry;
+	J9ZipIndex *index;
 	const char *name;
 
 	if (!dirEntry || !namePtr)
 		return NULL;
 
+	index = ZIP_SRP_GET(dirEntry->dirIndex, J9ZipIndex *);
+	if (NULL != index) {
+		UDATA mask = index->slotCount - 1;
+		UDATA slot = zipCache_hashName(namePtr, nameSize, isClass) & mask;
+
+		while (NULL != (entry = ZIP_SRP_GET(index->slots[slot], J9ZipDirEntry *))) {
+			name = J9ZIPDIRENTRY_NAME(entry);
+			if (!strncmp(name, namePtr, nameSize) && !name[nameSize]) {
+				if (isClass == ((entry->zipFileOffset & ISCLASS_BIT) != 0)) {
+					return entry;
+				}
+			}
+			slot = (slot + 1) & mask;
+		}
+		return NULL;
+	}
+
 	entry = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *);
 	while (entry) {
 		name = J9ZIPDIRENTRY_NAME(entry);
@@ -972,11 +1073,28 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 {
 	J9ZipFileRecord *record;
 	J9ZipFileEntry *entry;
+	J9ZipIndex *index;
 	IDATA i;
 
 	if (!dirEntry || !namePtr)
 		return NULL;
 
+	index = ZIP_SRP_GET(dirEntry->fileIndex, J9ZipIndex *);
+	if (NULL != index) {
+		UDATA mask = index->slotCount - 1;
+		UDATA slot = zipCache_hashName(namePtr, nameSize, isClass) & mask;
+
+		while (NULL != (entry = ZIP_SRP_GET(index->slots[slot], J9ZipFileEntry *))) {
+			if ((entry->nameLength == nameSize) && !memcmp(J9ZIPFILEENTRY_NAME(entry), namePtr, nameSize)) {
+				if (isClass == ((entry->zipFileOffset & ISCLASS_BIT) != 0)) {
+					return entry;
+				}
+			}
+			slot = (slot + 1) & mask;
+		}
+		return NULL;
+	}
+
 	record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
 	while (record) {
 		entry = record->entry;
@@ -998,6 +1116,182 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 
 
 
+/* Hashes namePtr[0..nameSize-1] together with the isClass value. */
+
+static UDATA zipCache_hashName(const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	UDATA hash = isClass ? 1 : 0;
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash * 31) + (U_8)namePtr[i];
+	}
+	/* mix the high bits down since the slot is taken from the low bits */
+	return hash ^ (hash >> 15);
+}
+
+
+
+/*
+ * Reserves a zeroed J9ZipIndex with room for entryCount entries at a load
+ * factor of at most one half.  The index is taken from the current chunk if
+ * it fits, in which case chunkActiveDir is cleared because the next file entry
+ * would no longer be contiguous with the active zipFileRecord.  Otherwise, when
+ * a portLib is provided, a chunk large enough for the index alone is allocated
+ * and linked in behind the current chunk, leaving the current chunk and
+ * chunkActiveDir untouched.
+ */
+
+static J9ZipIndex *zipCache_reserveIndex(J9PortLibrary * portLib, J9ZipCacheEntry *zce, UDATA entryCount)
+{
+	J9ZipChunkHeader *chunk = ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *);
+	J9ZipIndex *index;
+	UDATA slotCount = 1;
+	UDATA indexBytes;
+	char *unused;
+
+	while (slotCount < (entryCount * 2)) {
+		slotCount <<= 1;
+	}
+	indexBytes = sizeof(J9ZipIndex) + ((slotCount - 1) * sizeof(index->slots[0]));
+
+	index = (J9ZipIndex *) zipCache_reserveEntry(zce, chunk, indexBytes, 0, &unused);
+	if (NULL != index) {
+		ZIP_SRP_SET_TO_NULL(zce->chunkActiveDir);
+	} else {
+		J9ZipChunkHeader *indexChunk;
+
+		if ((NULL == portLib) || (NULL == chunk)) {
+			return NULL;
+		}
+		indexChunk = zipCache_allocateChunkOfSize(portLib, sizeof(J9ZipChunkHeader) + indexBytes);
+		if (NULL == indexChunk) {
+			return NULL;
+		}
+		ZIP_SRP_SET(indexChunk->next, ZIP_SRP_GET(chunk->next, J9ZipChunkHeader *));
+		ZIP_SRP_SET(chunk->next, indexChunk);
+		index = (J9ZipIndex *) zipCache_reserveEntry(zce, indexChunk, indexBytes, 0, &unused);
+	}
+	index->slotCount = slotCount;
+	index->entryCount = 0;
+	return index;
+}
+
+
+
+/* Inserts entry into index using linear probing. Returns FALSE if the index is already half full. */
+
+static BOOLEAN zipCache_indexInsert(J9ZipIndex *index, UDATA hash, void *entry)
+{
+	UDATA mask = index->slotCount - 1;
+	UDATA slot = hash & mask;
+
+	if (((index->entryCount + 1) * 2) > index->slotCount) {
+		return FALSE;
+	}
+	while (NULL != ZIP_SRP_GET(index->slots[slot], void *)) {
+		slot = (slot + 1) & mask;
+	}
+	ZIP_SRP_SET(index->slots[slot], entry);
+	index->entryCount += 1;
+	return TRUE;
+}
+
+
+
+/*
+ * Builds the file and directory indexes for dirEntry and, recursively, for all
+ * of its subdirectories.  Lists shorter than ZIP_CACHE_INDEX_THRESHOLD are not
+ * indexed.  Returns FALSE if any index could not be reserved; the affected
+ * directories continue to be searched linearly.
+ */
+
+static BOOLEAN zipCache_buildDirIndexes(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry)
+{
+	BOOLEAN result = TRUE;
+	J9ZipFileRecord *record;
+	J9ZipDirEntry *subDir;
+	UDATA fileCount = 0;
+	UDATA dirCount = 0;
+	UDATA i;
+
+	for (record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *); NULL != record; record = ZIP_SRP_GET(record->next, J9ZipFileRecord *)) {
+		fileCount += record->entryCount;
+	}
+	if ((fileCount >= ZIP_CACHE_INDEX_THRESHOLD) && (NULL == ZIP_SRP_GET(dirEntry->fileIndex, J9ZipIndex *))) {
+		J9ZipIndex *index = zipCache_reserveIndex(portLib, zce, fileCount);
+
+		if (NULL == index) {
+			result = FALSE;
+		} else {
+			for (record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *); NULL != record; record = ZIP_SRP_GET(record->next, J9ZipFileRecord *)) {
+				J9ZipFileEntry *fileEntry = record->entry;
+				for (i = 0; i < record->entryCount; i++) {
+					zipCache_indexInsert(index,
+							zipCache_hashName(J9ZIPFILEENTRY_NAME(fileEntry), fileEntry->nameLength, (fileEntry->zipFileOffset & ISCLASS_BIT) != 0),
+							fileEntry);
+					fileEntry = J9ZIPFILEENTRY_NEXT(fileEntry);
+				}
+			}
+			ZIP_SRP_SET(dirEntry->fileIndex, index);
+		}
+	}
+
+	for (subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *); NULL != subDir; subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *)) {
+		dirCount += 1;
+	}
+	if ((dirCount >= ZIP_CACHE_INDEX_THRESHOLD) && (NULL == ZIP_SRP_GET(dirEntry->dirIndex, J9ZipIndex *))) {
+		J9ZipIndex *index = zipCache_reserveIndex(portLib, zce, dirCount);
+
+		if (NULL == index) {
+			result = FALSE;
+		} else {
+			for (subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *); NULL != subDir; subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *)) {
+				const char *name = J9ZIPDIRENTRY_NAME(subDir);
+				zipCache_indexInsert(index, zipCache_hashName(name, strlen(name), (subDir->zipFileOffset & ISCLASS_BIT) != 0), subDir);
+			}
+			ZIP_SRP_SET(dirEntry->dirIndex, index);
+		}
+	}
+
+	for (subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *); NULL != subDir; subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *)) {
+		if (!zipCache_buildDirIndexes(portLib, zce, subDir)) {
+			result = FALSE;
+		}
+	}
+	return result;
+}
+
+
+
+/**
+ * Builds hashed indexes for the large file and directory lists in the zip cache,
+ * so that zipCache_findElement() does not walk them linearly. Called once the
+ * central directory has been read. Elements added afterwards are inserted into
+ * the existing indexes. Indexes built here are not persisted; zipCache_copy()
+ * rebuilds them inside the copied cache.
+ *
+ * @param[in] zipCache the zip cache
+ *
+ * @return TRUE if every index was built, FALSE if some lists remain unindexed
+ */
+BOOLEAN
+zipCache_buildIndexes(J9ZipCache * zipCache)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	J9ZipCacheEntry *zce = zci->entry;
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	if (zipCache_isCopied(zipCache)) {
+		/* a copied cache is read-only and already indexed */
+		return TRUE;
+	}
+#endif
+	return zipCache_buildDirIndexes(zipCache->portLib, zce, &zce->root);
+}
+
+
+
 /** 
  * Searches for a directory named elementName in zipCache and if found provides 
  * a handle to it that can be used to enumerate through all of the directory's files.
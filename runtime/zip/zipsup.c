@@ -56,6 +56,7 @@ J9ZipFunctionTable zipFunctions = {
 	zip_getZipEntry,
 	zip_getZipEntryComment,
 	zip_getZipEntryData,
+	zip_getZipEntryDataPointer,
 	zip_getZipEntryExtraField,
 	zip_getZipEntryFromOffset,
 	zip_getZipEntryRawData,
@@ -1429,6 +1430,11 @@ zip_readCacheData(J9PortLibrary * portLib, J9ZipFile *zipFile)
 		startCentralDir = (IDATA)((UDATA)endEntry.dirOffset);
 		zipCache_setStartCentralDir(zipFile->cache, startCentralDir);
 		result = zip_populateCache(portLib, zipFile, &endEntry, startCentralDir);
+		if (0 == result) {
+			/* Index the large directories before the cache is published. Failing to
+			 * build an index is not an error, the lookup falls back to a list walk. */
+			zipCache_buildIndexes(zipFile->cache);
+		}
 	}
 
 finished:
@@ -1952,6 +1958,47 @@ finished:
 	return result;
 }
 
+/**
+ *	Returns a pointer to the data of a stored (uncompressed) zip entry inside a read-only
+ *	mapping of the zip file, so the data is not copied. The mapping belongs to the zip
+ *	cache and stays valid until zipFile is released. Entries that are compressed, or that
+ *	cannot be mapped, must be read with @ref zip_getZipEntryData.
+ *
+ * @param[in] portLib the port library
+ * @param[in] zipFile the zip file being read from, opened with a cache
+ * @param[in] entry the zip entry, read with its data pointer
+ * @param[out] data on success points to the entry data
+ *
+ * @return 0 on success
+ * @return	ZIP_ERR_UNSUPPORTED_FILE_TYPE if the entry is compressed or the zip file cannot be mapped
+ * @return	ZIP_ERR_FILE_CORRUPT if the entry data lies outside the zip file
+ *
+ * @see zip_getZipEntryData
+ */
+I_32 zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data)
+{
+	I_32 result = ZIP_ERR_UNSUPPORTED_FILE_TYPE;
+
+	ENTER();
+
+	if ((ZIP_CM_Stored == entry->compressionMethod) && (0 != entry->dataPointer) && (NULL != zipFile->cache)) {
+		UDATA mappedSize = 0;
+		U_8 *mapping = zipCache_mapZipFile(zipFile->cache, &mappedSize);
+
+		if (NULL != mapping) {
+			if (((UDATA)entry->dataPointer + entry->uncompressedSize) > mappedSize) {
+				result = ZIP_ERR_FILE_CORRUPT;
+			} else {
+				*data = mapping + entry->dataPointer;
+				result = 0;
+			}
+		}
+	}
+
+	EXIT();
+	return result;
+}
+
 /** 
  *	Attempt to read the raw data for the zip entry entry.
  * 
@@ -0,0 +1,198 @@
+package j9vm.test.benchmark;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.ByteArrayOutputStream;
+import java.io.OutputStream;
+import java.net.URI;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import javax.tools.FileObject;
+import javax.tools.ForwardingJavaFileManager;
+import javax.tools.JavaCompiler;
+import javax.tools.JavaFileManager;
+import javax.tools.JavaFileObject;
+import javax.tools.SimpleJavaFileObject;
+import javax.tools.StandardJavaFileManager;
+import javax.tools.ToolProvider;
+
+/**
+ * Fixture shared by the class loading benchmarks: compiling generated sources in memory,
+ * defining the resulting classes in throwaway class loaders and timing work split between threads.
+ */
+public final class BenchmarkClasses {
+
+	private BenchmarkClasses() {
+	}
+
+	/**
+	 * A parallel capable class loader which defines classes from class file bytes held in memory.
+	 * Classes it is asked to load are looked up by name in the map it was created with.
+	 */
+	public static class DefiningLoader extends ClassLoader {
+		static {
+			registerAsParallelCapable();
+		}
+
+		private final Map<String, byte[]> classBytes;
+
+		public DefiningLoader() {
+			this(Collections.<String, byte[]>emptyMap());
+		}
+
+		public DefiningLoader(Map<String, byte[]> classBytes) {
+			super(BenchmarkClasses.class.getClassLoader());
+			this.classBytes = classBytes;
+		}
+
+		protected Class<?> findClass(String name) throws ClassNotFoundException {
+			byte[] bytes = classBytes.get(name);
+			if (null == bytes) {
+				throw new ClassNotFoundException(name);
+			}
+			return defineClass(name, bytes, 0, bytes.length);
+		}
+
+		/**
+		 * Defines a class directly.
+		 *
+		 * @param name the binary name of the class, or null to take it from the class file
+		 * @param bytes the class file
+		 * @return the new class
+		 */
+		public Class<?> define(String name, byte[] bytes) {
+			return defineClass(name, bytes, 0, bytes.length);
+		}
+	}
+
+	/**
+	 * The work of one thread of runThreads().
+	 */
+	public interface Worker {
+		void run(int thread) throws Throwable;
+	}
+
+	static class MemoryClassFile extends SimpleJavaFileObject {
+		private final ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+
+		MemoryClassFile(String className) {
+			super(URI.create("mem:///" + className.replace('.', '/') + Kind.CLASS.extension), Kind.CLASS);
+		}
+
+		public OutputStream openOutputStream() {
+			return bytes;
+		}
+
+		byte[] getBytes() {
+			return bytes.toByteArray();
+		}
+	}
+
+	static class MemorySource extends SimpleJavaFileObject {
+		private final String source;
+
+		MemorySource(String className, String source) {
+			super(URI.create("string:///" + className.replace('.', '/') + Kind.SOURCE.extension), Kind.SOURCE);
+			this.source = source;
+		}
+
+		public CharSequence getCharContent(boolean ignoreEncodingErrors) {
+			return source;
+		}
+	}
+
+	/**
+	 * Compiles sources in memory.  Requires a JDK (javax.tools).
+	 *
+	 * @param sources the source of each class, by binary name
+	 * @return the class file of each class, by binary name
+	 */
+	public static Map<String, byte[]> compile(Map<String, String> sources) {
+		JavaCompiler compiler = ToolProvider.getSystemJavaCompiler();
+		if (null == compiler) {
+			throw new IllegalStateException("The benchmark requires a JDK to compile the generated classes");
+		}
+		final Map<String, MemoryClassFile> outputs = new HashMap<String, MemoryClassFile>();
+		StandardJavaFileManager standardManager = compiler.getStandardFileManager(null, null, null);
+		JavaFileManager fileManager = new ForwardingJavaFileManager<StandardJavaFileManager>(standardManager) {
+			public JavaFileObject getJavaFileForOutput(Location location, String className, JavaFileObject.Kind kind, FileObject sibling) {
+				MemoryClassFile file = new MemoryClassFile(className);
+				outputs.put(className, file);
+				return file;
+			}
+		};
+		List<JavaFileObject> sourceFiles = new ArrayList<JavaFileObject>();
+		for (Map.Entry<String, String> entry : sources.entrySet()) {
+			sourceFiles.add(new MemorySource(entry.getKey(), entry.getValue()));
+		}
+		if (!compiler.getTask(null, fileManager, null, null, null, sourceFiles).call().booleanValue()) {
+			throw new IllegalStateException("Compilation of generated classes failed");
+		}
+		Map<String, byte[]> classBytes = new HashMap<String, byte[]>();
+		for (Map.Entry<String, MemoryClassFile> entry : outputs.entrySet()) {
+			classBytes.put(entry.getKey(), entry.getValue().getBytes());
+		}
+		return classBytes;
+	}
+
+	/**
+	 * Runs worker on threadCount new threads at once, each passed its index.
+	 *
+	 * @return the time in nanoseconds from starting the first thread until the last one finished
+	 * @throws RuntimeException if a worker failed
+	 */
+	public static long runThreads(int threadCount, final Worker worker) throws InterruptedException {
+		final Throwable[] failure = new Throwable[1];
+		Thread[] threads = new Thread[threadCount];
+		for (int t = 0; t < threadCount; t++) {
+			final int thread = t;
+			threads[t] = new Thread() {
+				public void run() {
+					try {
+						worker.run(thread);
+					} catch (Throwable e) {
+						synchronized (failure) {
+							failure[0] = e;
+						}
+					}
+				}
+			};
+		}
+		long start = System.nanoTime();
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].start();
+		}
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].join();
+		}
+		long elapsed = System.nanoTime() - start;
+		if (null != failure[0]) {
+			throw new RuntimeException("Benchmark thread failed", failure[0]);
+		}
+		return elapsed;
+	}
+}
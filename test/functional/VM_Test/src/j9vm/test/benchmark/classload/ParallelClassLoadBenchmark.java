@@ -0,0 +1,144 @@
+package j9vm.test.benchmark.classload;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import j9vm.test.benchmark.BenchmarkClasses;
+import j9vm.test.benchmark.BenchmarkClasses.DefiningLoader;
+
+/**
+ * Measures the time taken to load a large number of independent classes from many threads
+ * through one parallel capable class loader, as happens at application startup.
+ *
+ * Every generated class extends a common base class, implements several interfaces and has
+ * instance and static fields, so each definition builds an iTable, a vTable and a field layout.
+ * When initialize is true the classes are also initialized, which runs bytecode verification
+ * of every class on the loading threads.
+ * Requires a JDK (javax.tools) to compile the generated classes.
+ *
+ * Usage: ParallelClassLoadBenchmark [classCount] [threads] [iterations] [initialize]
+ */
+public class ParallelClassLoadBenchmark {
+
+	private static final String PACKAGE = "j9vm.test.benchmark.classload.generated";
+	private static final int INTERFACE_COUNT = 8;
+	private static final int INTERFACES_PER_CLASS = 3;
+
+	static String interfaceSource(int index) {
+		return "package " + PACKAGE + ";\npublic interface Iface" + index + " {\n"
+				+ "\tint call" + index + "(int x);\n"
+				+ "\tdefault int defaultCall" + index + "(int x) { return call" + index + "(x) + 1; }\n"
+				+ "}\n";
+	}
+
+	static String baseSource() {
+		StringBuilder source = new StringBuilder();
+		source.append("package ").append(PACKAGE).append(";\npublic class Base {\n");
+		for (int i = 0; i < 16; i++) {
+			source.append("\tpublic int base").append(i).append("(int x) { return x + ").append(i).append("; }\n");
+		}
+		source.append("}\n");
+		return source.toString();
+	}
+
+	static String classSource(int index) {
+		StringBuilder source = new StringBuilder();
+		source.append("package ").append(PACKAGE).append(";\npublic class Loaded").append(index).append(" extends Base implements ");
+		for (int i = 0; i < INTERFACES_PER_CLASS; i++) {
+			if (i > 0) {
+				source.append(", ");
+			}
+			source.append("Iface").append((index + i) % INTERFACE_COUNT);
+		}
+		source.append(" {\n");
+		for (int i = 0; i < 6; i++) {
+			source.append("\tint field").append(i).append(";\n");
+			source.append("\tstatic long staticField").append(i).append(";\n");
+		}
+		for (int i = 0; i < INTERFACES_PER_CLASS; i++) {
+			int iface = (index + i) % INTERFACE_COUNT;
+			source.append("\tpublic int call").append(iface).append("(int x) { return x * ").append(index).append("; }\n");
+		}
+		for (int i = 0; i < 16; i += 4) {
+			source.append("\tpublic int base").append(i).append("(int x) { return x - ").append(index).append("; }\n");
+		}
+		source.append("}\n");
+		return source.toString();
+	}
+
+	static Map<String, byte[]> compile(int classCount) {
+		Map<String, String> sources = new LinkedHashMap<String, String>();
+		for (int i = 0; i < INTERFACE_COUNT; i++) {
+			sources.put(PACKAGE + ".Iface" + i, interfaceSource(i));
+		}
+		sources.put(PACKAGE + ".Base", baseSource());
+		for (int i = 0; i < classCount; i++) {
+			sources.put(PACKAGE + ".Loaded" + i, classSource(i));
+		}
+		return BenchmarkClasses.compile(sources);
+	}
+
+	/* Load every generated class through a new loader, with the classes split evenly between the threads */
+	static long loadAll(Map<String, byte[]> classBytes, final int classCount, final int threadCount, final boolean initialize) throws Exception {
+		final ClassLoader loader = new DefiningLoader(classBytes);
+		/* the shared supertypes are loaded up front so that only the leaf classes are defined in parallel */
+		Class.forName(PACKAGE + ".Base", false, loader);
+		for (int i = 0; i < INTERFACE_COUNT; i++) {
+			Class.forName(PACKAGE + ".Iface" + i, false, loader);
+		}
+		return BenchmarkClasses.runThreads(threadCount, new BenchmarkClasses.Worker() {
+			public void run(int thread) throws Throwable {
+				for (int i = thread; i < classCount; i += threadCount) {
+					Class.forName(PACKAGE + ".Loaded" + i, initialize, loader);
+				}
+			}
+		});
+	}
+
+	public static void main(String[] args) throws Exception {
+		int classCount = (args.length > 0) ? Integer.parseInt(args[0]) : 2000;
+		int threadCount = (args.length > 1) ? Integer.parseInt(args[1]) : Runtime.getRuntime().availableProcessors();
+		int iterations = (args.length > 2) ? Integer.parseInt(args[2]) : 10;
+		boolean initialize = (args.length > 3) ? Boolean.parseBoolean(args[3]) : false;
+
+		Map<String, byte[]> classBytes = compile(classCount);
+
+		/* warm up */
+		loadAll(classBytes, classCount, threadCount, initialize);
+
+		long singleThreaded = 0;
+		long multiThreaded = 0;
+		for (int i = 0; i < iterations; i++) {
+			singleThreaded += loadAll(classBytes, classCount, 1, initialize);
+			multiThreaded += loadAll(classBytes, classCount, threadCount, initialize);
+		}
+		long classesLoaded = (long)iterations * classCount;
+
+		System.out.println("classCount=" + classCount + " threads=" + threadCount + " iterations=" + iterations + " initialize=" + initialize);
+		System.out.println("1 thread: " + (singleThreaded / classesLoaded) + " ns per class");
+		System.out.println(threadCount + " threads: " + (multiThreaded / classesLoaded) + " ns per class");
+		System.out.println("speedup: " + ((double)singleThreaded / (double)multiThreaded));
+	}
+}
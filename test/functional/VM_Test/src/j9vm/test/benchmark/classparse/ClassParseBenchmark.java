@@ -0,0 +1,172 @@
+package j9vm.test.benchmark.classparse;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.File;
+import java.io.InputStream;
+import java.net.URI;
+import java.nio.file.FileSystem;
+import java.nio.file.FileSystems;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Enumeration;
+import java.util.Iterator;
+import java.util.List;
+import java.util.jar.JarEntry;
+import java.util.jar.JarFile;
+import java.util.stream.Stream;
+
+import j9vm.test.benchmark.BenchmarkClasses.DefiningLoader;
+
+/**
+ * Measures how fast class files are parsed, by defining the JDK's own classes again in
+ * throwaway class loaders.
+ *
+ * The class files are read from the jrt:/ file system, or from lib/rt.jar on JDKs without
+ * modules.  Classes in java.* packages cannot be defined outside the boot loader and are
+ * skipped.  Many of the remaining classes fail to link against supertypes which are not
+ * accessible from the unnamed module, but only after their class files have been parsed
+ * and their ROM classes built, so such failures are counted and otherwise ignored.
+ * Most of the parsing time goes to validating, hashing and interning the UTF8 constant
+ * pool entries, which makes up the bulk of the bytes of typical class files.
+ *
+ * Usage: ClassParseBenchmark [maxClasses] [iterations]
+ */
+public class ClassParseBenchmark {
+
+	static boolean isCandidate(String entryName) {
+		return entryName.endsWith(".class")
+				&& !entryName.endsWith("module-info.class")
+				&& !entryName.startsWith("java/");
+	}
+
+	static byte[] readAll(InputStream in) throws Exception {
+		try {
+			byte[] buffer = new byte[8192];
+			int length = 0;
+			int count;
+			while ((count = in.read(buffer, length, buffer.length - length)) > 0) {
+				length += count;
+				if (length == buffer.length) {
+					byte[] larger = new byte[buffer.length * 2];
+					System.arraycopy(buffer, 0, larger, 0, length);
+					buffer = larger;
+				}
+			}
+			byte[] bytes = new byte[length];
+			System.arraycopy(buffer, 0, bytes, 0, length);
+			return bytes;
+		} finally {
+			in.close();
+		}
+	}
+
+	static List<byte[]> readJrtClasses(int maxClasses) throws Exception {
+		List<byte[]> classes = new ArrayList<byte[]>();
+		FileSystem jrt = FileSystems.getFileSystem(URI.create("jrt:/"));
+		Stream<Path> paths = Files.walk(jrt.getPath("/modules"));
+		try {
+			for (Iterator<Path> iterator = paths.iterator(); iterator.hasNext() && (classes.size() < maxClasses);) {
+				Path path = iterator.next();
+				/* entries are /modules/<module>/<package path>/<class>.class */
+				if (path.getNameCount() > 2) {
+					String entryName = path.subpath(2, path.getNameCount()).toString();
+					if (isCandidate(entryName)) {
+						classes.add(Files.readAllBytes(path));
+					}
+				}
+			}
+		} finally {
+			paths.close();
+		}
+		return classes;
+	}
+
+	static List<byte[]> readJarClasses(File jar, int maxClasses) throws Exception {
+		List<byte[]> classes = new ArrayList<byte[]>();
+		JarFile jarFile = new JarFile(jar);
+		try {
+			for (Enumeration<JarEntry> entries = jarFile.entries(); entries.hasMoreElements() && (classes.size() < maxClasses);) {
+				JarEntry entry = entries.nextElement();
+				if (isCandidate(entry.getName())) {
+					classes.add(readAll(jarFile.getInputStream(entry)));
+				}
+			}
+		} finally {
+			jarFile.close();
+		}
+		return classes;
+	}
+
+	static List<byte[]> readJDKClasses(int maxClasses) throws Exception {
+		File rtJar = new File(System.getProperty("java.home"), "lib" + File.separator + "rt.jar");
+		if (rtJar.isFile()) {
+			return readJarClasses(rtJar, maxClasses);
+		}
+		return readJrtClasses(maxClasses);
+	}
+
+	/* Define every class through a new loader, returning the number of classes which failed to link */
+	static int defineAll(List<byte[]> classes) {
+		DefiningLoader loader = new DefiningLoader();
+		int failures = 0;
+		for (byte[] bytes : classes) {
+			try {
+				loader.define(null, bytes);
+			} catch (LinkageError e) {
+				failures += 1;
+			} catch (SecurityException e) {
+				failures += 1;
+			}
+		}
+		return failures;
+	}
+
+	public static void main(String[] args) throws Exception {
+		int maxClasses = (args.length > 0) ? Integer.parseInt(args[0]) : 10000;
+		int iterations = (args.length > 1) ? Integer.parseInt(args[1]) : 10;
+
+		List<byte[]> classes = readJDKClasses(maxClasses);
+		long totalBytes = 0;
+		for (byte[] bytes : classes) {
+			totalBytes += bytes.length;
+		}
+
+		/* warm up */
+		int failures = defineAll(classes);
+
+		long elapsed = 0;
+		for (int i = 0; i < iterations; i++) {
+			long start = System.nanoTime();
+			defineAll(classes);
+			elapsed += System.nanoTime() - start;
+		}
+		long classesParsed = (long)iterations * classes.size();
+		long bytesParsed = (long)iterations * totalBytes;
+
+		System.out.println("classes=" + classes.size() + " bytes=" + totalBytes + " linkFailures=" + failures + " iterations=" + iterations);
+		System.out.println((elapsed / classesParsed) + " ns per class");
+		System.out.println(((bytesParsed * 1000000000L) / elapsed / 1024) + " KB of class files per second");
+	}
+}
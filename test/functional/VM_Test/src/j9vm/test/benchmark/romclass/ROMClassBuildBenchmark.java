@@ -0,0 +1,119 @@
+package j9vm.test.benchmark.romclass;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import j9vm.test.benchmark.BenchmarkClasses;
+import j9vm.test.benchmark.BenchmarkClasses.DefiningLoader;
+
+/**
+ * Measures ROM classes built per second when many threads define classes at the same time.
+ *
+ * The generated classes only extend java.lang.Object, but have many methods, string constants
+ * and member references, so most of the time spent defining them goes to parsing the class
+ * files and building the ROM classes.  Every thread defines its share of the classes directly
+ * through a class loader of its own, and a new set of loaders is used for every iteration.
+ * Requires a JDK (javax.tools) to compile the generated classes.
+ *
+ * Usage: ROMClassBuildBenchmark [classCount] [threads] [iterations]
+ */
+public class ROMClassBuildBenchmark {
+
+	private static final String PACKAGE = "j9vm.test.benchmark.romclass.generated";
+	private static final int METHODS_PER_CLASS = 24;
+
+	static String classSource(int index) {
+		StringBuilder source = new StringBuilder();
+		source.append("package ").append(PACKAGE).append(";\npublic class Built").append(index).append(" {\n");
+		for (int i = 0; i < 8; i++) {
+			source.append("\tprivate int field").append(i).append(";\n");
+			source.append("\tprivate static String name").append(i).append(" = \"Built").append(index).append(".name").append(i).append("\";\n");
+		}
+		for (int i = 0; i < METHODS_PER_CLASS; i++) {
+			source.append("\tpublic String method").append(i).append("(int x, String s) {\n");
+			source.append("\t\tif (x > ").append(i).append(") {\n");
+			source.append("\t\t\tfield").append(i % 8).append(" += x;\n");
+			source.append("\t\t\treturn s + \"method").append(i).append(" of Built").append(index).append("\" + name").append(i % 8).append(";\n");
+			source.append("\t\t}\n");
+			source.append("\t\tfor (int j = 0; j < x; j++) {\n");
+			source.append("\t\t\ts = s.concat(String.valueOf(j * ").append(i + 1).append("));\n");
+			source.append("\t\t}\n");
+			source.append("\t\treturn s;\n");
+			source.append("\t}\n");
+		}
+		source.append("}\n");
+		return source.toString();
+	}
+
+	static Map<String, byte[]> compile(int classCount) {
+		Map<String, String> sources = new LinkedHashMap<String, String>();
+		for (int i = 0; i < classCount; i++) {
+			sources.put(PACKAGE + ".Built" + i, classSource(i));
+		}
+		return BenchmarkClasses.compile(sources);
+	}
+
+	/* Define every generated class, with the classes split evenly between the threads */
+	static long defineAll(final String[] names, final byte[][] bytes, final int threadCount) throws Exception {
+		return BenchmarkClasses.runThreads(threadCount, new BenchmarkClasses.Worker() {
+			public void run(int thread) throws Throwable {
+				DefiningLoader loader = new DefiningLoader();
+				for (int i = thread; i < names.length; i += threadCount) {
+					loader.define(names[i], bytes[i]);
+				}
+			}
+		});
+	}
+
+	public static void main(String[] args) throws Exception {
+		int classCount = (args.length > 0) ? Integer.parseInt(args[0]) : 5000;
+		int threadCount = (args.length > 1) ? Integer.parseInt(args[1]) : Runtime.getRuntime().availableProcessors();
+		int iterations = (args.length > 2) ? Integer.parseInt(args[2]) : 5;
+
+		Map<String, byte[]> classBytes = compile(classCount);
+		String[] names = new String[classCount];
+		byte[][] bytes = new byte[classCount][];
+		for (int i = 0; i < classCount; i++) {
+			names[i] = PACKAGE + ".Built" + i;
+			bytes[i] = classBytes.get(names[i]);
+		}
+
+		/* warm up */
+		defineAll(names, bytes, threadCount);
+
+		long singleThreaded = 0;
+		long multiThreaded = 0;
+		for (int i = 0; i < iterations; i++) {
+			singleThreaded += defineAll(names, bytes, 1);
+			multiThreaded += defineAll(names, bytes, threadCount);
+		}
+		long classesDefined = (long)iterations * classCount;
+
+		System.out.println("classCount=" + classCount + " threads=" + threadCount + " iterations=" + iterations);
+		System.out.println("1 thread: " + ((classesDefined * 1000000000L) / singleThreaded) + " ROM classes per second");
+		System.out.println(threadCount + " threads: " + ((classesDefined * 1000000000L) / multiThreaded) + " ROM classes per second");
+		System.out.println("speedup: " + ((double)singleThreaded / (double)multiThreaded));
+	}
+}
@@ -0,0 +1,103 @@
+package j9vm.test.benchmark.vtable;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import j9vm.test.benchmark.BenchmarkClasses;
+import j9vm.test.benchmark.BenchmarkClasses.DefiningLoader;
+
+/**
+ * Measures RAM class creation time per class for deep hierarchies with large vTables.
+ *
+ * A hierarchy of classes is generated where every level overrides some of the inherited
+ * methods and declares new ones, then the whole hierarchy is defined repeatedly in fresh
+ * class loaders.  Requires a JDK (javax.tools) to compile the generated classes.
+ *
+ * Usage: VTableBuildBenchmark [depth] [methodsPerLevel] [iterations]
+ */
+public class VTableBuildBenchmark {
+
+	private static final String PACKAGE = "j9vm.test.benchmark.vtable.generated";
+
+	static String levelName(int level) {
+		return "Level" + level;
+	}
+
+	/* Level n declares methodsPerLevel new methods and overrides every second method of level n - 1 */
+	static String generateLevel(int level, int methodsPerLevel) {
+		StringBuilder source = new StringBuilder();
+		source.append("package ").append(PACKAGE).append(";\n");
+		source.append("public class ").append(levelName(level));
+		if (level > 0) {
+			source.append(" extends ").append(levelName(level - 1));
+		}
+		source.append(" {\n");
+		for (int i = 0; i < methodsPerLevel; i++) {
+			source.append("\tpublic int m").append(level).append('_').append(i).append("(int x) { return x + ").append(i).append("; }\n");
+		}
+		if (level > 0) {
+			for (int i = 0; i < methodsPerLevel; i += 2) {
+				source.append("\tpublic int m").append(level - 1).append('_').append(i).append("(int x) { return x - ").append(i).append("; }\n");
+			}
+		}
+		source.append("}\n");
+		return source.toString();
+	}
+
+	static Map<String, byte[]> compile(int depth, int methodsPerLevel) {
+		Map<String, String> sources = new LinkedHashMap<String, String>();
+		for (int level = 0; level < depth; level++) {
+			sources.put(PACKAGE + "." + levelName(level), generateLevel(level, methodsPerLevel));
+		}
+		return BenchmarkClasses.compile(sources);
+	}
+
+	public static void main(String[] args) throws Exception {
+		int depth = (args.length > 0) ? Integer.parseInt(args[0]) : 20;
+		int methodsPerLevel = (args.length > 1) ? Integer.parseInt(args[1]) : 20;
+		int iterations = (args.length > 2) ? Integer.parseInt(args[2]) : 200;
+
+		Map<String, byte[]> classBytes = compile(depth, methodsPerLevel);
+		String leafName = PACKAGE + "." + levelName(depth - 1);
+
+		/* warm up */
+		for (int i = 0; i < (iterations / 10) + 1; i++) {
+			Class.forName(leafName, false, new DefiningLoader(classBytes));
+		}
+
+		long start = System.nanoTime();
+		for (int i = 0; i < iterations; i++) {
+			/* loading the leaf defines every level of the hierarchy in the new loader */
+			Class.forName(leafName, false, new DefiningLoader(classBytes));
+		}
+		long elapsed = System.nanoTime() - start;
+		long classCount = (long)iterations * depth;
+
+		System.out.println("depth=" + depth + " methodsPerLevel=" + methodsPerLevel + " iterations=" + iterations);
+		System.out.println("classes defined: " + classCount);
+		System.out.println("total time: " + (elapsed / 1000000) + " ms");
+		System.out.println("time per class: " + (elapsed / classCount) + " ns");
+	}
+}
@@ -0,0 +1,150 @@
+package j9vm.test.benchmark.zipfile;
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.util.jar.JarOutputStream;
+import java.util.zip.ZipEntry;
+
+/**
+ * Measures VM zip cache lookups per second on a large jar.
+ *
+ * A jar holding classCount empty classes in a single package is generated and a child VM
+ * is started with the jar appended to the boot class path, so every bootstrap lookup in
+ * that package goes through the VM zip cache of the jar.  The child times lookups of names
+ * that are missing from the jar (a pure directory search) and the loading of every class
+ * in the jar.
+ *
+ * Usage: ZipLookupBenchmark [classCount] [iterations]
+ */
+public class ZipLookupBenchmark {
+
+	private static final String PACKAGE = "j9vm/test/benchmark/zipfile/lookup";
+
+	/* A minimal class file for PACKAGE/<simpleName> extending java.lang.Object */
+	static byte[] classBytes(String simpleName) throws IOException {
+		ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+		DataOutputStream out = new DataOutputStream(bytes);
+		out.writeInt(0xCAFEBABE);
+		out.writeShort(0);
+		out.writeShort(49);
+		out.writeShort(5);
+		out.writeByte(1);
+		out.writeUTF(PACKAGE + "/" + simpleName);
+		out.writeByte(7);
+		out.writeShort(1);
+		out.writeByte(1);
+		out.writeUTF("java/lang/Object");
+		out.writeByte(7);
+		out.writeShort(3);
+		out.writeShort(0x21);
+		out.writeShort(2);
+		out.writeShort(4);
+		out.writeShort(0);
+		out.writeShort(0);
+		out.writeShort(0);
+		out.writeShort(0);
+		out.flush();
+		return bytes.toByteArray();
+	}
+
+	static File generateJar(int classCount) throws IOException {
+		File jar = File.createTempFile("ZipLookupBenchmark", ".jar");
+		jar.deleteOnExit();
+		JarOutputStream out = new JarOutputStream(new FileOutputStream(jar));
+		try {
+			for (int i = 0; i < classCount; i++) {
+				String simpleName = "Entry" + i;
+				out.putNextEntry(new ZipEntry(PACKAGE + "/" + simpleName + ".class"));
+				out.write(classBytes(simpleName));
+				out.closeEntry();
+			}
+		} finally {
+			out.close();
+		}
+		return jar;
+	}
+
+	public static void main(String[] args) throws Exception {
+		int classCount = (args.length > 0) ? Integer.parseInt(args[0]) : 20000;
+		int iterations = (args.length > 1) ? Integer.parseInt(args[1]) : 20;
+
+		File jar = generateJar(classCount);
+		String javaExecutable = System.getProperty("java.home") + File.separator + "bin" + File.separator + "java";
+		ProcessBuilder builder = new ProcessBuilder(javaExecutable,
+				"-Xbootclasspath/a:" + jar.getAbsolutePath(),
+				"-cp", System.getProperty("java.class.path"),
+				Child.class.getName(),
+				String.valueOf(classCount), String.valueOf(iterations));
+		builder.inheritIO();
+		int exitCode = builder.start().waitFor();
+		if (0 != exitCode) {
+			throw new RuntimeException("Child VM exited with " + exitCode);
+		}
+	}
+
+	public static class Child {
+		public static void main(String[] args) throws Exception {
+			int classCount = Integer.parseInt(args[0]);
+			int iterations = Integer.parseInt(args[1]);
+			String prefix = PACKAGE.replace('/', '.') + ".";
+
+			/* warm up the lookup path and the exception creation */
+			lookupMissing(prefix, classCount);
+
+			long missingLookups = (long)iterations * classCount;
+			long start = System.nanoTime();
+			for (int i = 0; i < iterations; i++) {
+				lookupMissing(prefix, classCount);
+			}
+			long missingElapsed = System.nanoTime() - start;
+
+			start = System.nanoTime();
+			for (int i = 0; i < classCount; i++) {
+				Class.forName(prefix + "Entry" + i, false, null);
+			}
+			long loadElapsed = System.nanoTime() - start;
+
+			System.out.println("classCount=" + classCount + " iterations=" + iterations);
+			System.out.println("missing lookups: " + (missingElapsed / missingLookups) + " ns each, "
+					+ ((missingLookups * 1000000000L) / missingElapsed) + " per second");
+			System.out.println("class loads: " + (loadElapsed / classCount) + " ns each, "
+					+ (((long)classCount * 1000000000L) / loadElapsed) + " per second");
+		}
+
+		static void lookupMissing(String prefix, int count) {
+			for (int i = 0; i < count; i++) {
+				try {
+					Class.forName(prefix + "Missing" + i, false, null);
+					throw new RuntimeException("Unexpectedly found " + prefix + "Missing" + i);
+				} catch (ClassNotFoundException e) {
+					/* expected */
+				}
+			}
+		}
+	}
+}
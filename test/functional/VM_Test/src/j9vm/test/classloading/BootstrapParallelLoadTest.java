@@ -0,0 +1,150 @@
+package j9vm.test.classloading;
+
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.io.File;
+import java.net.URI;
+import java.nio.file.FileSystem;
+import java.nio.file.FileSystems;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Enumeration;
+import java.util.Iterator;
+import java.util.List;
+import java.util.stream.Stream;
+import java.util.zip.ZipEntry;
+import java.util.zip.ZipFile;
+
+/**
+ * Loads the same classes through the bootstrap class loader from many threads at once.
+ *
+ * Class path loads read the class bytes into a VM wide buffer, so a class being parsed must
+ * not see its bytes replaced by the load of another class.  Every thread loads every class
+ * of the jars on the class path, which BootstrapParallelLoadTestRunner appends to the
+ * bootstrap class path, and of java.base, each thread starting at a different class.  All
+ * threads must get the same class, with the requested name, or fail in the same way.
+ */
+public class BootstrapParallelLoadTest {
+
+	static List<String> classNames() throws Exception {
+		List<String> names = new ArrayList<String>();
+		for (String entry : System.getProperty("java.class.path").split(File.pathSeparator)) {
+			if (entry.endsWith(".jar")) {
+				ZipFile jar = new ZipFile(entry);
+				try {
+					for (Enumeration<? extends ZipEntry> e = jar.entries(); e.hasMoreElements();) {
+						addClassName(names, e.nextElement().getName());
+					}
+				} finally {
+					jar.close();
+				}
+			}
+		}
+		FileSystem jrt = null;
+		try {
+			jrt = FileSystems.getFileSystem(URI.create("jrt:/"));
+		} catch (Exception e) {
+			/* no jimage before Java 9, the jars are enough */
+		}
+		if (null != jrt) {
+			Path base = jrt.getPath("/modules/java.base");
+			Stream<Path> paths = Files.walk(base);
+			try {
+				for (Iterator<Path> i = paths.iterator(); i.hasNext();) {
+					addClassName(names, base.relativize(i.next()).toString());
+				}
+			} finally {
+				paths.close();
+			}
+		}
+		return names;
+	}
+
+	static void addClassName(List<String> names, String fileName) {
+		if (fileName.endsWith(".class") && !fileName.endsWith("module-info.class") && !fileName.endsWith("package-info.class")) {
+			names.add(fileName.substring(0, fileName.length() - ".class".length()).replace('/', '.'));
+		}
+	}
+
+	static Object load(String name) {
+		try {
+			return Class.forName(name, false, null);
+		} catch (Throwable e) {
+			return e.getClass().getName();
+		}
+	}
+
+	public static void main(String[] args) throws Exception {
+		final String[] names = classNames().toArray(new String[0]);
+		final int threadCount = Math.max(8, Runtime.getRuntime().availableProcessors());
+		final Object[][] results = new Object[threadCount][names.length];
+		Thread[] threads = new Thread[threadCount];
+
+		for (int t = 0; t < threadCount; t++) {
+			final int thread = t;
+			threads[t] = new Thread() {
+				public void run() {
+					int start = (int)(((long)names.length * thread) / threadCount);
+					for (int i = 0; i < names.length; i++) {
+						int index = (start + i) % names.length;
+						results[thread][index] = load(names[index]);
+					}
+				}
+			};
+		}
+		for (Thread thread : threads) {
+			thread.start();
+		}
+		for (Thread thread : threads) {
+			thread.join();
+		}
+
+		int failures = 0;
+		for (int i = 0; i < names.length; i++) {
+			Object expected = results[0][i];
+			boolean failed = false;
+			if ((expected instanceof Class) && !((Class<?>)expected).getName().equals(names[i])) {
+				System.out.println(names[i] + " loaded as " + ((Class<?>)expected).getName());
+				failed = true;
+			} else if ("java.lang.ClassFormatError".equals(expected)) {
+				System.out.println(names[i] + " failed with " + expected);
+				failed = true;
+			}
+			for (int t = 1; t < threadCount; t++) {
+				if (!expected.equals(results[t][i])) {
+					System.out.println(names[i] + ": thread 0 got " + expected + ", thread " + t + " got " + results[t][i]);
+					failed = true;
+				}
+			}
+			if (failed) {
+				failures += 1;
+			}
+		}
+		System.out.println(names.length + " classes loaded by " + threadCount + " threads, " + failures + " failures");
+		if (0 != failures) {
+			throw new RuntimeException("BootstrapParallelLoadTest failed");
+		}
+	}
+}
@@ -0,0 +1,107 @@
+package j9vm.test.stacktrace;
+
+
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.lang.reflect.Field;
+import java.util.Arrays;
+
+/**
+ * Checks that -XX:+InternStackTraces shares the walkback of exceptions thrown from identical stacks,
+ * and only those.
+ *
+ * A walkback is interned once its call site has been seen twice in a row with the same depth, so
+ * the first exception from a site gets its own walkback and the second one is recorded in the table.
+ * Exceptions thrown from the same site after that must share the second walkback, and an exception
+ * thrown from another site must not.  InternStackTracesTestRunner runs the test with -Xint, so the
+ * PCs of a stack do not change when methods are compiled.
+ */
+public class InternStackTracesTest {
+
+	static final int SAME_SITE_COUNT = 4;
+
+	static Field walkbackField;
+
+	static void thrower() {
+		throw new IllegalStateException();
+	}
+
+	static RuntimeException throwFromSameSite() {
+		try {
+			thrower();
+		} catch (RuntimeException e) {
+			return e;
+		}
+		return null;
+	}
+
+	static RuntimeException throwFromOtherSite() {
+		try {
+			thrower();
+		} catch (RuntimeException e) {
+			return e;
+		}
+		return null;
+	}
+
+	static Object walkback(Throwable t) throws Exception {
+		return walkbackField.get(t);
+	}
+
+	public static void main(String[] args) throws Exception {
+		walkbackField = Throwable.class.getDeclaredField("walkback");
+		walkbackField.setAccessible(true);
+
+		RuntimeException[] sameSite = new RuntimeException[SAME_SITE_COUNT];
+		for (int i = 0; i < SAME_SITE_COUNT; i++) {
+			sameSite[i] = throwFromSameSite();
+		}
+		RuntimeException otherSite = throwFromOtherSite();
+
+		int failures = 0;
+		for (int i = 2; i < SAME_SITE_COUNT; i++) {
+			if (walkback(sameSite[1]) != walkback(sameSite[i])) {
+				System.out.println("exception " + i + " from the same site does not share the walkback of exception 1");
+				failures += 1;
+			}
+			if (!Arrays.equals(sameSite[1].getStackTrace(), sameSite[i].getStackTrace())) {
+				System.out.println("exception " + i + " from the same site has a different stack trace");
+				failures += 1;
+			}
+		}
+		for (int i = 0; i < SAME_SITE_COUNT; i++) {
+			if (walkback(otherSite) == walkback(sameSite[i])) {
+				System.out.println("exception from the other site shares the walkback of exception " + i);
+				failures += 1;
+			}
+		}
+		if (Arrays.equals(otherSite.getStackTrace(), sameSite[1].getStackTrace())) {
+			System.out.println("exception from the other site has the stack trace of the same site");
+			failures += 1;
+		}
+		if (0 != failures) {
+			throw new RuntimeException("InternStackTracesTest failed");
+		}
+		System.out.println("InternStackTracesTest passed");
+	}
+}
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Builds up a finalization backlog large enough for the finalize master to start its helper slaves
+ * (run with -Xgc:finalizeSlaveCount=N). Exactly one of these command line values must be specified:
+ * --drain Every object is finalized and every weak reference enqueued, using System.runFinalization()
+ * --exit The VM exits while the finalizer threads are still working through the backlog
+ * --exitFromFinalizer A finalizer calls System.exit() while the other finalizer threads are busy
+ */
+public class FinalizeHelperMain
+{
+	public static final int OBJECT_COUNT = 100000;
+	public static final int MAX_ROUNDS = 60;
+
+	static final AtomicInteger _finalized = new AtomicInteger();
+	static volatile boolean _exitFromFinalizer = false;
+
+	static class Finalizable
+	{
+		final int _id;
+		final byte[] _payload = new byte[16];
+
+		Finalizable(int id)
+		{
+			_id = id;
+		}
+
+		protected void finalize()
+		{
+			int count = _finalized.incrementAndGet();
+			if (_exitFromFinalizer && (count == (OBJECT_COUNT / 2)))
+			{
+				System.out.println("Exiting from a finalizer");
+				System.exit(0);
+			}
+		}
+	}
+
+	static class SlowFinalizable extends Finalizable
+	{
+		SlowFinalizable(int id)
+		{
+			super(id);
+		}
+
+		protected void finalize()
+		{
+			super.finalize();
+			try
+			{
+				Thread.sleep(1);
+			}
+			catch (InterruptedException e)
+			{
+				/* ignore, this only keeps the finalizer threads busy */
+			}
+		}
+	}
+
+	public static void main(String[] args)
+	{
+		if (_match(args, "--drain"))
+		{
+			drain();
+		}
+		else if (_match(args, "--exit"))
+		{
+			createGarbage(true);
+			System.gc();
+			System.out.println("Exiting with finalization in progress");
+			System.exit(0);
+		}
+		else if (_match(args, "--exitFromFinalizer"))
+		{
+			_exitFromFinalizer = true;
+			createGarbage(true);
+			System.gc();
+			/* The finalizer which calls System.exit() ends the test */
+			for (int round = 0; round < MAX_ROUNDS; round++)
+			{
+				System.runFinalization();
+				try
+				{
+					Thread.sleep(1000);
+				}
+				catch (InterruptedException e)
+				{
+					/* ignore */
+				}
+			}
+			System.out.println("Test error: no finalizer called System.exit()");
+		}
+		else
+		{
+			System.out.println("Test error: expected one of --drain, --exit or --exitFromFinalizer");
+		}
+	}
+
+	static void drain()
+	{
+		ReferenceQueue<Object> queue = new ReferenceQueue<Object>();
+		WeakReference<?>[] references = new WeakReference<?>[OBJECT_COUNT];
+		for (int i = 0; i < OBJECT_COUNT; i++)
+		{
+			references[i] = new WeakReference<Object>(new Object(), queue);
+		}
+		createGarbage(false);
+
+		int enqueued = 0;
+		for (int round = 0; round < MAX_ROUNDS; round++)
+		{
+			System.gc();
+			System.runFinalization();
+			while (null != queue.poll())
+			{
+				enqueued += 1;
+			}
+			if ((OBJECT_COUNT == _finalized.get()) && (OBJECT_COUNT == enqueued))
+			{
+				break;
+			}
+		}
+
+		if ((OBJECT_COUNT == _finalized.get()) && (OBJECT_COUNT == enqueued))
+		{
+			System.out.println("PASS: all " + OBJECT_COUNT + " objects finalized and references enqueued");
+		}
+		else
+		{
+			System.out.println("FAIL: " + _finalized.get() + " of " + OBJECT_COUNT + " objects finalized, " + enqueued + " references enqueued");
+		}
+	}
+
+	static void createGarbage(boolean slow)
+	{
+		for (int i = 0; i < OBJECT_COUNT; i++)
+		{
+			if (slow)
+			{
+				new SlowFinalizable(i);
+			}
+			else
+			{
+				new Finalizable(i);
+			}
+		}
+	}
+
+	private static boolean _match(String[] args, String option)
+	{
+		for (String arg : args)
+		{
+			if (option.equals(arg))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
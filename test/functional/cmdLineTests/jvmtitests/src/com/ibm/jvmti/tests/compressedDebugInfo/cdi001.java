@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvmti.tests.compressedDebugInfo;
+
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
+import java.lang.ref.WeakReference;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+
+public class cdi001
+{
+	static final String TARGET_NAME = "com.ibm.jvmti.tests.compressedDebugInfo.cdi001_target";
+
+	public static native int[] getLineNumbers(Method method);
+
+	/**
+	 * Defines cdi001_target itself rather than delegating to the application class loader.
+	 */
+	static class TargetLoader extends ClassLoader
+	{
+		TargetLoader()
+		{
+			super(cdi001.class.getClassLoader());
+		}
+
+		protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException
+		{
+			if (!TARGET_NAME.equals(name)) {
+				return super.loadClass(name, resolve);
+			}
+			synchronized (getClassLoadingLock(name)) {
+				Class<?> clazz = findLoadedClass(name);
+				if (null == clazz) {
+					byte[] classBytes = readClassBytes(name);
+					clazz = defineClass(name, classBytes, 0, classBytes.length);
+				}
+				if (resolve) {
+					resolveClass(clazz);
+				}
+				return clazz;
+			}
+		}
+
+		private static byte[] readClassBytes(String name) throws ClassNotFoundException
+		{
+			InputStream in = cdi001.class.getResourceAsStream("/" + name.replace('.', '/') + ".class");
+			if (null == in) {
+				throw new ClassNotFoundException(name);
+			}
+			try {
+				ByteArrayOutputStream out = new ByteArrayOutputStream();
+				byte[] buffer = new byte[4096];
+				int count;
+				while ((count = in.read(buffer)) != -1) {
+					out.write(buffer, 0, count);
+				}
+				in.close();
+				return out.toByteArray();
+			} catch (java.io.IOException e) {
+				throw new ClassNotFoundException(name, e);
+			}
+		}
+	}
+
+	public boolean setup(String args)
+	{
+		return true;
+	}
+
+	private static int getLineConstant(Class<?> target, String name) throws Exception
+	{
+		return target.getField(name).getInt(null);
+	}
+
+	private static boolean checkStackTrace(Class<?> target) throws Exception
+	{
+		int callLine = getLineConstant(target, "CALL_LINE");
+		int throwLine = getLineConstant(target, "THROW_LINE");
+		Throwable thrown = null;
+
+		try {
+			target.getMethod("call").invoke(null);
+		} catch (InvocationTargetException e) {
+			thrown = e.getCause();
+		}
+		if (!(thrown instanceof IllegalStateException)) {
+			System.out.println("call() did not throw IllegalStateException: " + thrown);
+			return false;
+		}
+
+		StackTraceElement[] trace = thrown.getStackTrace();
+		if ((trace.length < 2)
+			|| !"thrower".equals(trace[0].getMethodName()) || (throwLine != trace[0].getLineNumber())
+			|| !"call".equals(trace[1].getMethodName()) || (callLine != trace[1].getLineNumber())
+		) {
+			System.out.println("Unexpected stack trace, expected thrower() at line " + throwLine + " and call() at line " + callLine);
+			thrown.printStackTrace(System.out);
+			return false;
+		}
+		if (!"cdi001_target.java".equals(trace[0].getFileName())) {
+			System.out.println("Unexpected source file name " + trace[0].getFileName());
+			return false;
+		}
+		return true;
+	}
+
+	private static boolean checkLineNumberTable(Class<?> target) throws Exception
+	{
+		int callLine = getLineConstant(target, "CALL_LINE");
+		int throwLine = getLineConstant(target, "THROW_LINE");
+
+		int[] throwerLines = getLineNumbers(target.getDeclaredMethod("thrower"));
+		if ((null == throwerLines) || (1 != throwerLines.length) || (throwLine != throwerLines[0])) {
+			System.out.println("Unexpected line number table for thrower(), expected only line " + throwLine);
+			return false;
+		}
+
+		int[] callLines = getLineNumbers(target.getDeclaredMethod("call"));
+		if ((null == callLines) || (0 == callLines.length) || (callLine != callLines[0])) {
+			System.out.println("Unexpected line number table for call(), expected line " + callLine + " first");
+			return false;
+		}
+		return true;
+	}
+
+	public boolean testStackTraceLineNumbers() throws Exception
+	{
+		return checkStackTrace(new TargetLoader().loadClass(TARGET_NAME));
+	}
+
+	public String helpStackTraceLineNumbers()
+	{
+		return "Check the line numbers in a stack trace through a class with compressed debug info.";
+	}
+
+	public boolean testGetLineNumberTable() throws Exception
+	{
+		return checkLineNumberTable(new TargetLoader().loadClass(TARGET_NAME));
+	}
+
+	public String helpGetLineNumberTable()
+	{
+		return "Check GetLineNumberTable on the methods of a class with compressed debug info.";
+	}
+
+	/**
+	 * Loads the target in a new loader, checks its line numbers and returns a weak reference to the loader.
+	 */
+	private static WeakReference<ClassLoader> loadAndCheck() throws Exception
+	{
+		TargetLoader loader = new TargetLoader();
+		Class<?> target = loader.loadClass(TARGET_NAME);
+		if (!checkStackTrace(target) || !checkLineNumberTable(target)) {
+			return null;
+		}
+		return new WeakReference<ClassLoader>(loader);
+	}
+
+	public boolean testLoaderUnload() throws Exception
+	{
+		for (int round = 0; round < 3; round++) {
+			WeakReference<ClassLoader> loaderRef = loadAndCheck();
+			if (null == loaderRef) {
+				return false;
+			}
+			for (int attempt = 0; (null != loaderRef.get()) && (attempt < 10); attempt++) {
+				System.gc();
+				Thread.sleep(100);
+			}
+			if (null != loaderRef.get()) {
+				System.out.println("Class loader of round " + round + " was not unloaded");
+				return false;
+			}
+		}
+		return true;
+	}
+
+	public String helpLoaderUnload()
+	{
+		return "Unload class loaders of classes with compressed debug info and load the classes again.";
+	}
+}
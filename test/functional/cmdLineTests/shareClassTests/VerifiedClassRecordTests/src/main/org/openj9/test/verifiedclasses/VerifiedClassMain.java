@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package org.openj9.test.verifiedclasses;
+
+import java.io.File;
+import java.lang.reflect.Method;
+import java.net.URL;
+import java.net.URLClassLoader;
+
+/**
+ * Loads Child in one of the ways the shared cache verification records must handle.
+ *
+ * Usage: VerifiedClassMain &lt;mode&gt; [child.jar]
+ *   preload    load Parent and Base before Child, so a recorded verification can be used
+ *   lazy       load Child first, its dependencies are not loaded when it is verified
+ *   hierarchy  load only Parent and Base
+ *   loader     load Child from child.jar with a new class loader whose parent defines Parent
+ */
+public class VerifiedClassMain {
+	private static final String PACKAGE = "org.openj9.test.verifiedclasses.";
+
+	public static void main(String[] args) throws Exception {
+		String mode = args[0];
+		ClassLoader appLoader = VerifiedClassMain.class.getClassLoader();
+		ClassLoader childLoader = appLoader;
+
+		if ("preload".equals(mode) || "hierarchy".equals(mode)) {
+			Class.forName(PACKAGE + "Base", true, appLoader);
+			Class.forName(PACKAGE + "Parent", true, appLoader);
+			if ("hierarchy".equals(mode)) {
+				System.out.println("Hierarchy loaded");
+				return;
+			}
+		} else if ("loader".equals(mode)) {
+			childLoader = new URLClassLoader(new URL[] { new File(args[1]).toURI().toURL() }, appLoader);
+		}
+
+		try {
+			Class<?> child = Class.forName(PACKAGE + "Child", true, childLoader);
+			Method check = child.getMethod("check");
+			System.out.println("Check returned " + check.invoke(null) + " from " + child.getClassLoader());
+		} catch (LinkageError e) {
+			System.out.println("Verification failed: " + e);
+		}
+	}
+}